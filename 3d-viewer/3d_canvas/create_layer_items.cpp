@@ -46,10 +46,9 @@
 #include <convert_basic_shapes_to_polygon.h>
 #include <trigo.h>
 #include <vector>
-#include <thread>
 #include <core/arraydim.h>
+#include <core/thread_pool.h>
 #include <algorithm>
-#include <atomic>
 #include <wx/log.h>
 
 #ifdef PRINT_STATISTICS_3D_VIEWER
@@ -733,24 +732,13 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
         }
 
         // Add zones objects
-        std::atomic<size_t> nextZone( 0 );
-        std::atomic<size_t> threadsFinished( 0 );
-
-        size_t parallelThreadCount = std::min<size_t>( zones.size(),
-                std::max<size_t>( std::thread::hardware_concurrency(), 2 ) );
-
-        for( size_t ii = 0; ii < parallelThreadCount; ++ii )
-        {
-            std::thread t = std::thread( [&]()
-            {
-                for( size_t areaId = nextZone.fetch_add( 1 );
-                            areaId < zones.size();
-                            areaId = nextZone.fetch_add( 1 ) )
+        RunOnThreadPool( zones.size(),
+                [&]( size_t areaId )
                 {
                     ZONE* zone = zones[areaId].first;
 
                     if( zone == nullptr )
-                        break;
+                        return;
 
                     PCB_LAYER_ID layer = zones[areaId].second;
 
@@ -768,16 +756,7 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
                         std::lock_guard< std::mutex > lock( *( mut_it->second ) );
                         zone->TransformSolidAreasShapesToPolygon( layer, *layerPolyContainer->second );
                     }
-                }
-
-                threadsFinished++;
-            } );
-
-            t.detach();
-        }
-
-        while( threadsFinished < parallelThreadCount )
-            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+                } );
     }
     // End Build Copper layers
 
@@ -1130,39 +1109,17 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
                                                            (int) selected_layer_id.size() ) );
             }
 
-            std::atomic<size_t> nextItem( 0 );
-            std::atomic<size_t> threadsFinished( 0 );
-
-            size_t parallelThreadCount = std::min<size_t>(
-                    std::max<size_t>( std::thread::hardware_concurrency(), 2 ),
-                    selected_layer_id.size() );
+            RunOnThreadPool( selected_layer_id.size(),
+                    [&]( size_t i )
+                    {
+                        auto layerPoly = m_layers_poly.find( selected_layer_id[i] );
 
-            for( size_t ii = 0; ii < parallelThreadCount; ++ii )
-            {
-                std::thread t = std::thread(
-                        [&nextItem, &threadsFinished, &selected_layer_id, this]()
+                        if( layerPoly != m_layers_poly.end() )
                         {
-                            for( size_t i = nextItem.fetch_add( 1 );
-                                        i < selected_layer_id.size();
-                                        i = nextItem.fetch_add( 1 ) )
-                            {
-                                auto layerPoly = m_layers_poly.find( selected_layer_id[i] );
-
-                                if( layerPoly != m_layers_poly.end() )
-                                {
-                                    // This will make a union of all added contours
-                                    layerPoly->second->Simplify( SHAPE_POLY_SET::PM_FAST );
-                                }
-                            }
-
-                            threadsFinished++;
-                        } );
-
-                t.detach();
-            }
-
-            while( threadsFinished < parallelThreadCount )
-                std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+                            // This will make a union of all added contours
+                            layerPoly->second->Simplify( SHAPE_POLY_SET::PM_FAST );
+                        }
+                    } );
         }
     }
 
@@ -1190,21 +1147,23 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
     if( aStatusReporter )
         aStatusReporter->Report( _( "Build BVH for holes and vias" ) );
 
-    m_TH_IDs.BuildBVH();
-    m_TH_ODs.BuildBVH();
-    m_viaAnnuli.BuildBVH();
+    std::vector<BVH_CONTAINER_2D*> containers = { &m_TH_IDs, &m_TH_ODs, &m_viaAnnuli };
 
-    if( !m_layerHoleMap.empty() )
-    {
-        for( std::pair<const PCB_LAYER_ID, BVH_CONTAINER_2D*>& hole : m_layerHoleMap )
-            hole.second->BuildBVH();
-    }
+    for( std::pair<const PCB_LAYER_ID, BVH_CONTAINER_2D*>& hole : m_layerHoleMap )
+        containers.push_back( hole.second );
 
     // We only need the Solder mask to initialize the BVH
     // because..?
     if( m_layerMap[B_Mask] )
-        m_layerMap[B_Mask]->BuildBVH();
+        containers.push_back( m_layerMap[B_Mask] );
 
     if( m_layerMap[F_Mask] )
-        m_layerMap[F_Mask]->BuildBVH();
+        containers.push_back( m_layerMap[F_Mask] );
+
+    // The containers are independent from each other, so build them concurrently
+    RunOnThreadPool( containers.size(),
+            [&]( size_t i )
+            {
+                containers[i]->BuildBVH();
+            } );
 }
@@ -28,8 +28,8 @@
 
 #include "container_2d.h"
 #include "../ray.h"
-#include <boost/range/algorithm/partition.hpp>
-#include <boost/range/algorithm/nth_element.hpp>
+#include <algorithm>
+#include <cfloat>
 #include <wx/debug.h>
 
 
@@ -83,8 +83,6 @@ BVH_CONTAINER_2D::BVH_CONTAINER_2D() : CONTAINER_2D_BASE( OBJECT_2D_TYPE::BVHCON
 {
     m_isInitialized = false;
     m_bbox.Reset();
-    m_elementsToDelete.clear();
-    m_tree = nullptr;
 }
 
 
@@ -97,15 +95,8 @@ void BVH_CONTAINER_2D::Clear()
 
 void BVH_CONTAINER_2D::destroy()
 {
-    for( std::list<BVH_CONTAINER_NODE_2D*>::iterator ii = m_elementsToDelete.begin();
-         ii != m_elementsToDelete.end();
-         ++ii )
-    {
-        delete *ii;
-    }
-
-    m_elementsToDelete.clear();
-    m_tree = nullptr;
+    std::vector<BVH_CONTAINER_NODE_2D>().swap( m_nodes );
+    std::vector<const OBJECT_2D*>().swap( m_leafObjects );
     m_isInitialized = false;
 }
 
@@ -118,6 +109,14 @@ BVH_CONTAINER_2D::~BVH_CONTAINER_2D()
 
 #define BVH_CONTAINER2D_MAX_OBJ_PER_LEAF 4
 
+/// Number of buckets the centroids are sorted in to evaluate the split costs
+#define BVH_CONTAINER2D_SAH_BINS 16
+
+/// Below this depth the nodes are split at the median, which bounds the depth of the tree
+#define BVH_CONTAINER2D_MAX_SAH_DEPTH 48
+
+#define BVH_CONTAINER2D_STACK_SIZE 128
+
 
 void BVH_CONTAINER_2D::BuildBVH()
 {
@@ -127,124 +126,173 @@ void BVH_CONTAINER_2D::BuildBVH()
     m_isInitialized = true;
 
     if( m_objects.empty() )
-    {
         return;
-    }
 
-    m_tree = new BVH_CONTAINER_NODE_2D;
+    std::vector<BUILD_ITEM> items;
 
-    m_elementsToDelete.push_back( m_tree );
-    m_tree->m_BBox = m_bbox;
+    items.reserve( m_objects.size() );
 
-    for( LIST_OBJECT2D::const_iterator ii = m_objects.begin(); ii != m_objects.end(); ++ii )
-    {
-        m_tree->m_LeafList.push_back( static_cast<const OBJECT_2D*>( *ii ) );
-    }
+    for( const OBJECT_2D* object : m_objects )
+        items.push_back( { object, object->GetBBox(), object->GetCentroid() } );
 
-    recursiveBuild_MIDDLE_SPLIT( m_tree );
-}
+    // A binary tree whose leaves hold at least one object has less than twice as many nodes
+    // as objects, so the node array never reallocates while building
+    m_nodes.reserve( 2 * items.size() );
+    m_nodes.emplace_back();
+    m_nodes[0].m_BBox = m_bbox;
 
+    recursiveBuild_SAH( items, 0, 0, (unsigned int) items.size(), 0 );
 
-// Based on a blog post by VADIM KRAVCENKO
-// http://www.vadimkravcenko.com/bvh-tree-building
-// Implements:
+    m_leafObjects.reserve( items.size() );
 
-// "Split in the middle of the longest Axis"
-// "Creates a binary tree with Top-Down approach.
-//  Fastest BVH building, but least [speed] accuracy."
-static bool sortByCentroidX( const OBJECT_2D* a, const OBJECT_2D* b )
-{
-    return a->GetCentroid()[0] < b->GetCentroid()[0];
+    for( const BUILD_ITEM& item : items )
+        m_leafObjects.push_back( item.m_Object );
 }
 
 
-static bool sortByCentroidY( const OBJECT_2D* a, const OBJECT_2D* b )
+// Binned SAH build, after "On fast Construction of SAH-based Bounding Volume Hierarchies"
+// (I. Wald, 2007).  In 2D the cost of a node is proportional to its perimeter.
+void BVH_CONTAINER_2D::recursiveBuild_SAH( std::vector<BUILD_ITEM>& aItems,
+                                           unsigned int aNodeIndex, unsigned int aFirst,
+                                           unsigned int aCount, unsigned int aDepth )
 {
-    return a->GetCentroid()[0] < b->GetCentroid()[0];
-}
+    wxASSERT( aCount > 0 );
+    wxASSERT( m_nodes[aNodeIndex].m_BBox.IsInitialized() == true );
+
+    if( aCount <= BVH_CONTAINER2D_MAX_OBJ_PER_LEAF )
+    {
+        // It is a Leaf
+        m_nodes[aNodeIndex].m_FirstIndex = aFirst;
+        m_nodes[aNodeIndex].m_ObjectCount = aCount;
+        return;
+    }
 
+    const auto itemsBegin = aItems.begin() + aFirst;
+    const auto itemsEnd = itemsBegin + aCount;
 
-static bool sortByCentroidZ( const OBJECT_2D* a, const OBJECT_2D* b )
-{
-    return a->GetCentroid()[0] < b->GetCentroid()[0];
-}
+    BBOX_2D centroidBBox;
+    centroidBBox.Reset();
 
+    for( auto ii = itemsBegin; ii != itemsEnd; ++ii )
+        centroidBBox.Union( ii->m_Centroid );
 
-void BVH_CONTAINER_2D::recursiveBuild_MIDDLE_SPLIT( BVH_CONTAINER_NODE_2D* aNodeParent )
-{
-    wxASSERT( aNodeParent != nullptr );
-    wxASSERT( aNodeParent->m_BBox.IsInitialized() == true );
-    wxASSERT( aNodeParent->m_LeafList.size() > 0 );
+    int          bestAxis = -1;
+    unsigned int bestBin = 0;
+    float        bestCost = FLT_MAX;
 
-    if( aNodeParent->m_LeafList.size() > BVH_CONTAINER2D_MAX_OBJ_PER_LEAF )
+    auto binOf =
+            [&]( const BUILD_ITEM& aItem, int aAxis ) -> unsigned int
+            {
+                const float extent = centroidBBox.Max()[aAxis] - centroidBBox.Min()[aAxis];
+                const float pos = ( aItem.m_Centroid[aAxis] - centroidBBox.Min()[aAxis] )
+                                  * ( BVH_CONTAINER2D_SAH_BINS / extent );
+
+                return std::min( (unsigned int) pos, (unsigned int) BVH_CONTAINER2D_SAH_BINS - 1 );
+            };
+
+    for( int axis = 0; axis < 2 && aDepth < BVH_CONTAINER2D_MAX_SAH_DEPTH; ++axis )
     {
-        // Create Leaf Nodes
-        BVH_CONTAINER_NODE_2D* leftNode  = new BVH_CONTAINER_NODE_2D;
-        BVH_CONTAINER_NODE_2D* rightNode = new BVH_CONTAINER_NODE_2D;
-        m_elementsToDelete.push_back( leftNode );
-        m_elementsToDelete.push_back( rightNode );
-
-        leftNode->m_BBox.Reset();
-        rightNode->m_BBox.Reset();
-        leftNode->m_LeafList.clear();
-        rightNode->m_LeafList.clear();
-
-        // Decide which axis to split
-        const unsigned int axis_to_split = aNodeParent->m_BBox.MaxDimension();
-
-        // Divide the objects
-        switch( axis_to_split )
+        if( centroidBBox.Max()[axis] <= centroidBBox.Min()[axis] )
+            continue;
+
+        BBOX_2D      binBBox[BVH_CONTAINER2D_SAH_BINS];
+        unsigned int binCount[BVH_CONTAINER2D_SAH_BINS] = {};
+
+        for( BBOX_2D& bbox : binBBox )
+            bbox.Reset();
+
+        for( auto ii = itemsBegin; ii != itemsEnd; ++ii )
         {
-            case 0: aNodeParent->m_LeafList.sort( sortByCentroidX ); break;
-            case 1: aNodeParent->m_LeafList.sort( sortByCentroidY ); break;
-            case 2: aNodeParent->m_LeafList.sort( sortByCentroidZ ); break;
+            const unsigned int bin = binOf( *ii, axis );
+
+            binCount[bin]++;
+            binBBox[bin].Union( ii->m_BBox );
         }
 
-        unsigned int i = 0;
+        // Cost of everything right of each split position
+        float        rightCost[BVH_CONTAINER2D_SAH_BINS];
+        BBOX_2D      bbox;
+        unsigned int count = 0;
+
+        bbox.Reset();
 
-        for( CONST_LIST_OBJECT2D::const_iterator ii = aNodeParent->m_LeafList.begin();
-             ii != aNodeParent->m_LeafList.end();
-             ++ii )
+        for( unsigned int bin = BVH_CONTAINER2D_SAH_BINS - 1; bin > 0; --bin )
         {
-            const OBJECT_2D* object = static_cast<const OBJECT_2D*>( *ii );
+            bbox.Union( binBBox[bin] );
+            count += binCount[bin];
+            rightCost[bin] = count ? count * bbox.Perimeter() : 0.0f;
+        }
 
-            if( i < (aNodeParent->m_LeafList.size() / 2 ) )
-            {
-                leftNode->m_BBox.Union( object->GetBBox() );
-                leftNode->m_LeafList.push_back( object );
-            }
-            else
-            {
-                rightNode->m_BBox.Union( object->GetBBox() );
-                rightNode->m_LeafList.push_back( object );
-            }
+        bbox.Reset();
+        count = 0;
 
-            i++;
-        }
+        for( unsigned int bin = 0; bin < BVH_CONTAINER2D_SAH_BINS - 1; ++bin )
+        {
+            bbox.Union( binBBox[bin] );
+            count += binCount[bin];
 
-        wxASSERT( leftNode->m_LeafList.size() > 0 );
-        wxASSERT( rightNode->m_LeafList.size() > 0 );
-        wxASSERT( ( leftNode->m_LeafList.size() + rightNode->m_LeafList.size() ) ==
-                  aNodeParent->m_LeafList.size() );
+            if( count == 0 || count == aCount )
+                continue;
 
-        aNodeParent->m_Children[0] = leftNode;
-        aNodeParent->m_Children[1] = rightNode;
-        aNodeParent->m_LeafList.clear();
+            const float cost = count * bbox.Perimeter() + rightCost[bin + 1];
 
-        recursiveBuild_MIDDLE_SPLIT( leftNode );
-        recursiveBuild_MIDDLE_SPLIT( rightNode );
+            if( cost < bestCost )
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = bin;
+            }
+        }
+    }
 
-        wxASSERT( aNodeParent->m_LeafList.size() == 0 );
+    auto splitItem = itemsBegin + aCount / 2;
+
+    if( bestAxis >= 0 )
+    {
+        splitItem = std::partition( itemsBegin, itemsEnd,
+                                    [&]( const BUILD_ITEM& aItem )
+                                    {
+                                        return binOf( aItem, bestAxis ) <= bestBin;
+                                    } );
     }
     else
     {
-        // It is a Leaf
-        aNodeParent->m_Children[0] = nullptr;
-        aNodeParent->m_Children[1] = nullptr;
+        // No usable split (too deep, or all the centroids are in the same place): split at the
+        // median of the longest axis
+        const unsigned int axis = centroidBBox.MaxDimension();
+
+        std::nth_element( itemsBegin, splitItem, itemsEnd,
+                          [axis]( const BUILD_ITEM& aA, const BUILD_ITEM& aB )
+                          {
+                              return aA.m_Centroid[axis] < aB.m_Centroid[axis];
+                          } );
     }
 
-    wxASSERT( aNodeParent != nullptr );
-    wxASSERT( aNodeParent->m_BBox.IsInitialized() == true );
+    const unsigned int leftCount = (unsigned int) ( splitItem - itemsBegin );
+
+    wxASSERT( leftCount > 0 && leftCount < aCount );
+
+    // Create the children next to each other
+    const unsigned int leftNode = (unsigned int) m_nodes.size();
+
+    m_nodes.emplace_back();
+    m_nodes.emplace_back();
+
+    m_nodes[aNodeIndex].m_FirstIndex = leftNode;
+    m_nodes[aNodeIndex].m_ObjectCount = 0;
+
+    m_nodes[leftNode].m_BBox.Reset();
+    m_nodes[leftNode + 1].m_BBox.Reset();
+
+    for( auto ii = itemsBegin; ii != splitItem; ++ii )
+        m_nodes[leftNode].m_BBox.Union( ii->m_BBox );
+
+    for( auto ii = splitItem; ii != itemsEnd; ++ii )
+        m_nodes[leftNode + 1].m_BBox.Union( ii->m_BBox );
+
+    recursiveBuild_SAH( aItems, leftNode, aFirst, leftCount, aDepth + 1 );
+    recursiveBuild_SAH( aItems, leftNode + 1, aFirst + leftCount, aCount - leftCount,
+                        aDepth + 1 );
 }
 
 
@@ -252,29 +300,30 @@ bool BVH_CONTAINER_2D::IntersectAny( const RAYSEG2D& aSegRay ) const
 {
     wxASSERT( m_isInitialized == true );
 
-    if( m_tree )
-        return recursiveIntersectAny( m_tree, aSegRay );
+    if( m_nodes.empty() )
+        return false;
 
-    return false;
-}
+    unsigned int stack[BVH_CONTAINER2D_STACK_SIZE];
+    unsigned int stackSize = 0;
 
+    stack[stackSize++] = 0;
 
-bool BVH_CONTAINER_2D::recursiveIntersectAny( const BVH_CONTAINER_NODE_2D* aNode,
-                                              const RAYSEG2D& aSegRay ) const
-{
-    wxASSERT( aNode != nullptr );
-
-    if( aNode->m_BBox.Inside( aSegRay.m_Start ) || aNode->m_BBox.Inside( aSegRay.m_End ) ||
-        aNode->m_BBox.Intersect( aSegRay ) )
+    while( stackSize > 0 )
     {
-        if( !aNode->m_LeafList.empty() )
+        const BVH_CONTAINER_NODE_2D& node = m_nodes[stack[--stackSize]];
+
+        if( !node.m_BBox.Inside( aSegRay.m_Start ) && !node.m_BBox.Inside( aSegRay.m_End )
+                && !node.m_BBox.Intersect( aSegRay ) )
         {
-            wxASSERT( aNode->m_Children[0] == nullptr );
-            wxASSERT( aNode->m_Children[1] == nullptr );
+            continue;
+        }
 
-            // Leaf
-            for( const OBJECT_2D* obj : aNode->m_LeafList )
+        if( node.IsLeaf() )
+        {
+            for( unsigned int ii = 0; ii < node.m_ObjectCount; ++ii )
             {
+                const OBJECT_2D* obj = m_leafObjects[node.m_FirstIndex + ii];
+
                 if( obj->IsPointInside( aSegRay.m_Start ) ||
                     obj->IsPointInside( aSegRay.m_End ) ||
                     obj->Intersect( aSegRay, nullptr, nullptr ) )
@@ -283,15 +332,11 @@ bool BVH_CONTAINER_2D::recursiveIntersectAny( const BVH_CONTAINER_NODE_2D* aNode
         }
         else
         {
-            wxASSERT( aNode->m_Children[0] != nullptr );
-            wxASSERT( aNode->m_Children[1] != nullptr );
+            wxASSERT( stackSize + 2 <= BVH_CONTAINER2D_STACK_SIZE );
 
-            // Node
-            if( recursiveIntersectAny( aNode->m_Children[0], aSegRay ) )
-                return true;
-
-            if( recursiveIntersectAny( aNode->m_Children[1], aSegRay ) )
-                return true;
+            // Visit the first child first
+            stack[stackSize++] = node.m_FirstIndex + 1;
+            stack[stackSize++] = node.m_FirstIndex;
         }
     }
 
@@ -307,31 +352,26 @@ void BVH_CONTAINER_2D::GetIntersectingObjects( const BBOX_2D& aBBox,
 
     aOutList.clear();
 
-    if( m_tree )
-        recursiveGetListObjectsIntersects( m_tree, aBBox, aOutList );
-}
+    if( m_nodes.empty() )
+        return;
 
+    unsigned int stack[BVH_CONTAINER2D_STACK_SIZE];
+    unsigned int stackSize = 0;
 
-void BVH_CONTAINER_2D::recursiveGetListObjectsIntersects( const BVH_CONTAINER_NODE_2D* aNode,
-                                                          const BBOX_2D& aBBox,
-                                                          CONST_LIST_OBJECT2D& aOutList ) const
-{
-    wxASSERT( aNode != nullptr );
-    wxASSERT( aBBox.IsInitialized() == true );
+    stack[stackSize++] = 0;
 
-    if( aNode->m_BBox.Intersects( aBBox ) )
+    while( stackSize > 0 )
     {
-        if( !aNode->m_LeafList.empty() )
-        {
-            wxASSERT( aNode->m_Children[0] == nullptr );
-            wxASSERT( aNode->m_Children[1] == nullptr );
+        const BVH_CONTAINER_NODE_2D& node = m_nodes[stack[--stackSize]];
 
-            // Leaf
-            for( CONST_LIST_OBJECT2D::const_iterator ii = aNode->m_LeafList.begin();
-                 ii != aNode->m_LeafList.end();
-                 ++ii )
+        if( !node.m_BBox.Intersects( aBBox ) )
+            continue;
+
+        if( node.IsLeaf() )
+        {
+            for( unsigned int ii = 0; ii < node.m_ObjectCount; ++ii )
             {
-                const OBJECT_2D* obj = static_cast<const OBJECT_2D*>( *ii );
+                const OBJECT_2D* obj = m_leafObjects[node.m_FirstIndex + ii];
 
                 if( obj->Intersects( aBBox ) )
                     aOutList.push_back( obj );
@@ -339,12 +379,10 @@ void BVH_CONTAINER_2D::recursiveGetListObjectsIntersects( const BVH_CONTAINER_NO
         }
         else
         {
-            wxASSERT( aNode->m_Children[0] != nullptr );
-            wxASSERT( aNode->m_Children[1] != nullptr );
+            wxASSERT( stackSize + 2 <= BVH_CONTAINER2D_STACK_SIZE );
 
-            // Node
-            recursiveGetListObjectsIntersects( aNode->m_Children[0], aBBox, aOutList );
-            recursiveGetListObjectsIntersects( aNode->m_Children[1], aBBox, aOutList );
+            stack[stackSize++] = node.m_FirstIndex + 1;
+            stack[stackSize++] = node.m_FirstIndex;
         }
     }
 }
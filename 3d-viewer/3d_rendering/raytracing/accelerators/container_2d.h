@@ -30,13 +30,13 @@
 #define _CONTAINER_2D_H_
 
 #include "../shapes2D/object_2d.h"
-#include <list>
 #include <mutex>
+#include <vector>
 
 struct RAYSEG2D;
 
-typedef std::list<OBJECT_2D*> LIST_OBJECT2D;
-typedef std::list<const OBJECT_2D*> CONST_LIST_OBJECT2D;
+typedef std::vector<OBJECT_2D*> LIST_OBJECT2D;
+typedef std::vector<const OBJECT_2D*> CONST_LIST_OBJECT2D;
 
 
 class CONTAINER_2D_BASE
@@ -103,13 +103,22 @@ public:
 };
 
 
-struct BVH_CONTAINER_NODE_2D
+/**
+ * A node of the flattened BVH.  Nodes are 32 bytes so that they never straddle a cache line,
+ * and the two children of a node are stored next to each other.
+ */
+struct alignas( 32 ) BVH_CONTAINER_NODE_2D
 {
-    BBOX_2D                 m_BBox;
-    BVH_CONTAINER_NODE_2D*  m_Children[2];
+    BBOX_2D      m_BBox;
+
+    /// Index of the first child node for an inner node, or of the first object in the
+    /// leaf object array for a leaf.
+    unsigned int m_FirstIndex;
 
-    /// Store the list of objects if that node is a Leaf
-    CONST_LIST_OBJECT2D     m_LeafList;
+    /// Number of objects of a leaf, 0 for an inner node
+    unsigned int m_ObjectCount;
+
+    bool IsLeaf() const { return m_ObjectCount > 0; }
 };
 
 
@@ -119,6 +128,9 @@ public:
     BVH_CONTAINER_2D();
     ~BVH_CONTAINER_2D();
 
+    /**
+     * Build the hierarchy using a binned surface area heuristic.
+     */
     void BuildBVH();
 
     void Clear() override;
@@ -129,18 +141,26 @@ public:
     bool IntersectAny( const RAYSEG2D& aSegRay ) const override;
 
 private:
+    struct BUILD_ITEM
+    {
+        const OBJECT_2D* m_Object;
+        BBOX_2D          m_BBox;
+        SFVEC2F          m_Centroid;
+    };
+
     void destroy();
-    void recursiveBuild_MIDDLE_SPLIT( BVH_CONTAINER_NODE_2D* aNodeParent );
-    void recursiveGetListObjectsIntersects( const BVH_CONTAINER_NODE_2D* aNode,
-                                            const BBOX_2D& aBBox,
-                                            CONST_LIST_OBJECT2D& aOutList ) const;
-    bool recursiveIntersectAny( const BVH_CONTAINER_NODE_2D* aNode,
-                                const RAYSEG2D& aSegRay ) const;
+
+    /**
+     * Turn the node \a aNodeIndex covering the build items [\a aFirst, \a aFirst + \a aCount)
+     * into a leaf or split it in two children.
+     */
+    void recursiveBuild_SAH( std::vector<BUILD_ITEM>& aItems, unsigned int aNodeIndex,
+                             unsigned int aFirst, unsigned int aCount, unsigned int aDepth );
 
     bool m_isInitialized;
-    std::list<BVH_CONTAINER_NODE_2D*> m_elementsToDelete;
-    BVH_CONTAINER_NODE_2D* m_tree;
 
+    std::vector<BVH_CONTAINER_NODE_2D> m_nodes;        ///< The tree, the root being first
+    std::vector<const OBJECT_2D*>      m_leafObjects;  ///< The objects, in leaf order
 };
 
 #endif // _CONTAINER_2D_H_
@@ -27,7 +27,6 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
-#include <thread>
 
 #include "render_3d_raytrace.h"
 #include "mortoncodes.h"
@@ -36,6 +35,7 @@
 #include "3d_math.h"
 #include "../common_ogl/ogl_utils.h"
 #include <core/profile.h>        // To use GetRunningMicroSecs or another profiling utility
+#include <core/thread_pool.h>
 #include <wx/log.h>
 
 
@@ -346,46 +346,26 @@ void RENDER_3D_RAYTRACE::renderTracing( GLubyte* ptrPBO, REPORTER* aStatusReport
     m_isPreview = false;
 
     auto startTime = std::chrono::steady_clock::now();
-    bool breakLoop = false;
+    std::atomic<bool> breakLoop( false );
 
     std::atomic<size_t> numBlocksRendered( 0 );
-    std::atomic<size_t> currentBlock( 0 );
-    std::atomic<size_t> threadsFinished( 0 );
 
-    size_t parallelThreadCount = std::min<size_t>(
-            std::max<size_t>( std::thread::hardware_concurrency(), 2 ),
-            m_blockPositions.size() );
-
-    for( size_t ii = 0; ii < parallelThreadCount; ++ii )
-    {
-        std::thread t = std::thread( [&]()
-        {
-            for( size_t iBlock = currentBlock.fetch_add( 1 );
-                 iBlock < m_blockPositions.size() && !breakLoop;
-                 iBlock = currentBlock.fetch_add( 1 ) )
+    RunOnThreadPool( m_blockPositions.size(),
+            [&]( size_t iBlock )
             {
-                if( !m_blockPositionsWasProcessed[iBlock] )
-                {
-                    renderBlockTracing( ptrPBO, iBlock );
-                    numBlocksRendered++;
-                    m_blockPositionsWasProcessed[iBlock] = 1;
-
-                    // Check if it spend already some time render and request to exit
-                    // to display the progress
-                    if( std::chrono::duration_cast<std::chrono::milliseconds>(
-                            std::chrono::steady_clock::now() - startTime ).count() > 150 )
-                        breakLoop = true;
-                }
-            }
-
-            threadsFinished++;
-        } );
-
-        t.detach();
-    }
-
-    while( threadsFinished < parallelThreadCount )
-        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+                if( breakLoop || m_blockPositionsWasProcessed[iBlock] )
+                    return;
+
+                renderBlockTracing( ptrPBO, iBlock );
+                numBlocksRendered++;
+                m_blockPositionsWasProcessed[iBlock] = 1;
+
+                // Check if it spend already some time render and request to exit
+                // to display the progress
+                if( std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - startTime ).count() > 150 )
+                    breakLoop = true;
+            } );
 
     m_blockRenderProgressCount += numBlocksRendered;
 
@@ -842,17 +822,8 @@ void RENDER_3D_RAYTRACE::postProcessShading( GLubyte* /* ptrPBO */, REPORTER* aS
 
         m_postShaderSsao.SetShadowsEnabled( m_boardAdapter.m_Cfg->m_Render.raytrace_shadows );
 
-        std::atomic<size_t> nextBlock( 0 );
-        std::atomic<size_t> threadsFinished( 0 );
-
-        size_t parallelThreadCount = std::max<size_t>( std::thread::hardware_concurrency(), 2 );
-
-        for( size_t ii = 0; ii < parallelThreadCount; ++ii )
-        {
-            std::thread t = std::thread( [&]()
-            {
-                for( size_t y = nextBlock.fetch_add( 1 ); y < m_realBufferSize.y;
-                     y = nextBlock.fetch_add( 1 ) )
+        RunOnThreadPool( m_realBufferSize.y,
+                [&]( size_t y )
                 {
                     SFVEC3F* ptr = &m_shaderBuffer[ y * m_realBufferSize.x ];
 
@@ -861,16 +832,7 @@ void RENDER_3D_RAYTRACE::postProcessShading( GLubyte* /* ptrPBO */, REPORTER* aS
                         *ptr = m_postShaderSsao.Shade( SFVEC2I( x, y ) );
                         ptr++;
                     }
-                }
-
-                threadsFinished++;
-            } );
-
-            t.detach();
-        }
-
-        while( threadsFinished < parallelThreadCount )
-            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+                } );
 
         m_postShaderSsao.SetShadedBuffer( m_shaderBuffer );
 
@@ -890,17 +852,8 @@ void RENDER_3D_RAYTRACE::postProcessBlurFinish( GLubyte* ptrPBO, REPORTER* /* aS
     if( m_boardAdapter.m_Cfg->m_Render.raytrace_post_processing )
     {
         // Now blurs the shader result and compute the final color
-        std::atomic<size_t> nextBlock( 0 );
-        std::atomic<size_t> threadsFinished( 0 );
-
-        size_t parallelThreadCount = std::max<size_t>( std::thread::hardware_concurrency(), 2 );
-
-        for( size_t ii = 0; ii < parallelThreadCount; ++ii )
-        {
-            std::thread t = std::thread( [&]()
-            {
-                for( size_t y = nextBlock.fetch_add( 1 ); y < m_realBufferSize.y;
-                     y = nextBlock.fetch_add( 1 ) )
+        RunOnThreadPool( m_realBufferSize.y,
+                [&]( size_t y )
                 {
                     GLubyte* ptr = &ptrPBO[ y * m_realBufferSize.x * 4 ];
 
@@ -922,16 +875,7 @@ void RENDER_3D_RAYTRACE::postProcessBlurFinish( GLubyte* ptrPBO, REPORTER* /* aS
 
                         ptr += 4;
                     }
-                }
-
-                threadsFinished++;
-            } );
-
-            t.detach();
-        }
-
-        while( threadsFinished < parallelThreadCount )
-            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+                } );
 
         // Debug code
         //m_postShaderSsao.DebugBuffersOutputAsImages();
@@ -946,19 +890,8 @@ void RENDER_3D_RAYTRACE::renderPreview( GLubyte* ptrPBO )
 {
     m_isPreview = true;
 
-    std::atomic<size_t> nextBlock( 0 );
-    std::atomic<size_t> threadsFinished( 0 );
-
-    size_t parallelThreadCount = std::min<size_t>(
-            std::max<size_t>( std::thread::hardware_concurrency(), 2 ),
-            m_blockPositions.size() );
-
-    for( size_t ii = 0; ii < parallelThreadCount; ++ii )
-    {
-        std::thread t = std::thread( [&]()
-        {
-            for( size_t iBlock = nextBlock.fetch_add( 1 ); iBlock < m_blockPositionsFast.size();
-                 iBlock = nextBlock.fetch_add( 1 ) )
+    RunOnThreadPool( m_blockPositionsFast.size(),
+            [&]( size_t iBlock )
             {
                 const SFVEC2UI& windowPosUI = m_blockPositionsFast[ iBlock ];
                 const SFVEC2I windowsPos = SFVEC2I( windowPosUI.x + m_xoffset,
@@ -1523,16 +1456,7 @@ void RENDER_3D_RAYTRACE::renderPreview( GLubyte* ptrPBO )
                         SetPixel( ptr + 12, BlendColor( cRBC, BlendColor( cRB , cC ) ) );
                     }
                 }
-            }
-
-            threadsFinished++;
-        } );
-
-        t.detach();
-    }
-
-    while( threadsFinished < parallelThreadCount )
-        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            } );
 }
 
 
@@ -1850,6 +1774,10 @@ static float distance( const SFVEC2UI& a, const SFVEC2UI& b )
 }
 
 
+/// Number of blocks along each side of the square tiles the regular rendering is scheduled in
+#define RAYTRACE_TILE_BLOCKS 8
+
+
 void RENDER_3D_RAYTRACE::initializeBlockPositions()
 {
     m_realBufferSize = SFVEC2UI( 0 );
@@ -1896,7 +1824,9 @@ void RENDER_3D_RAYTRACE::initializeBlockPositions()
 
     m_postShaderSsao.UpdateSize( m_realBufferSize );
 
-    // Calc block positions for regular rendering. Choose an 'inside out' style of rendering.
+    // Calc block positions for regular rendering.  The blocks are grouped in square tiles which
+    // are rendered in an 'inside out' order, and the blocks of a tile follow the Morton order so
+    // the threads working on neighbouring blocks at the same time share most of the scene data.
     m_blockPositions.clear();
     const int blocks_x = m_realBufferSize.x / RAYPACKET_DIM;
     const int blocks_y = m_realBufferSize.y / RAYPACKET_DIM;
@@ -1908,21 +1838,44 @@ void RENDER_3D_RAYTRACE::initializeBlockPositions()
             m_blockPositions.emplace_back( x * RAYPACKET_DIM, y * RAYPACKET_DIM );
     }
 
+    const unsigned int tileSize = RAYTRACE_TILE_BLOCKS * RAYPACKET_DIM;
+
+    auto tileOf =
+            [&]( const SFVEC2UI& aBlock ) -> SFVEC2UI
+            {
+                return SFVEC2UI( aBlock.x / tileSize, aBlock.y / tileSize );
+            };
+
+    auto mortonInTile =
+            [&]( const SFVEC2UI& aBlock ) -> uint32_t
+            {
+                return EncodeMorton2( ( aBlock.x / RAYPACKET_DIM ) % RAYTRACE_TILE_BLOCKS,
+                                      ( aBlock.y / RAYPACKET_DIM ) % RAYTRACE_TILE_BLOCKS );
+            };
+
     const SFVEC2UI center( m_realBufferSize.x / 2, m_realBufferSize.y / 2 );
     std::sort( m_blockPositions.begin(), m_blockPositions.end(),
             [&]( const SFVEC2UI& a, const SFVEC2UI& b )
             {
-                // Sort order: inside out.
-                float distanceA = distance( a, center );
-                float distanceB = distance( b, center );
+                const SFVEC2UI tileA = tileOf( a );
+                const SFVEC2UI tileB = tileOf( b );
+
+                if( tileA != tileB )
+                {
+                    // Sort order: inside out.
+                    float distanceA = distance( tileA * tileSize + tileSize / 2, center );
+                    float distanceB = distance( tileB * tileSize + tileSize / 2, center );
+
+                    if( distanceA != distanceB )
+                        return distanceA < distanceB;
 
-                if( distanceA != distanceB )
-                    return distanceA < distanceB;
+                    if( tileA[0] != tileB[0] )
+                        return tileA[0] < tileB[0];
 
-                if( a[0] != b[0] )
-                    return a[0] < b[0];
+                    return tileA[1] < tileB[1];
+                }
 
-                return a[1] < b[1];
+                return mortonInTile( a ) < mortonInTile( b );
             } );
 
     // Create m_shader buffer
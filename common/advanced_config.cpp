@@ -104,6 +104,7 @@ static const wxChar EnableEeschemaPrintCairo[] = wxT( "EnableEeschemaPrintCairo"
 static const wxChar DisambiguationTime[] = wxT( "DisambiguationTime" );
 static const wxChar PcbSelectionVisibilityRatio[] = wxT( "PcbSelectionVisibilityRatio" );
 static const wxChar MinimumSegmentLength[] = wxT( "MinimumSegmentLength" );
+static const wxChar MaxUndoMemory[] = wxT( "MaxUndoMemory" );
 } // namespace KEYS
 
 
@@ -248,6 +249,8 @@ ADVANCED_CFG::ADVANCED_CFG()
 
     m_MinimumSegmentLength      = 50;
 
+    m_MaxUndoMemory             = 2048;
+
     loadFromConfigFile();
 }
 
@@ -444,6 +447,9 @@ void ADVANCED_CFG::loadSettings( wxConfigBase& aCfg )
                                                   &m_MinimumSegmentLength,
                                                   m_MinimumSegmentLength, 10, 1000 ) );
 
+    configParams.push_back( new PARAM_CFG_INT( true, AC_KEYS::MaxUndoMemory, &m_MaxUndoMemory,
+                                               m_MaxUndoMemory, 0, 65536 ) );
+
     // Special case for trace mask setting...we just grab them and set them immediately
     // Because we even use wxLogTrace inside of advanced config
     wxString traceMasks;
@@ -0,0 +1,82 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <functional>
+
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+
+#include <cache_file.h>
+#include <kiplatform/io.h>
+#include <paths.h>
+
+
+wxString CACHE_FILE::GetPath( const wxString& aSubdir, const wxString& aKey,
+                              const wxString& aExtension )
+{
+    wxFileName fn;
+
+    fn.AssignDir( PATHS::GetUserCachePath() );
+    fn.AppendDir( aSubdir );
+
+    // The hash only has to spread the keys over file names; the readers check the full key
+    size_t hash = std::hash<std::string>{}( std::string( aKey.utf8_str() ) );
+
+    fn.SetName( wxString::Format( wxT( "%016llx" ), (unsigned long long) hash ) );
+    fn.SetExt( aExtension );
+
+    return fn.GetFullPath();
+}
+
+
+bool CACHE_FILE::Write( const wxString& aPath, const std::string& aContent )
+{
+    wxFileName fn( aPath );
+
+    if( !PATHS::EnsurePathExists( fn.GetPath() ) )
+        return false;
+
+    wxString tmpPath = wxFileName::CreateTempFileName( aPath );
+
+    if( tmpPath.IsEmpty() )
+        return false;
+
+    bool written = false;
+
+    {
+        wxFFile file( tmpPath, wxT( "wb" ) );
+
+        if( file.IsOpened() )
+            written = file.Write( aContent.data(), aContent.size() ) == aContent.size();
+    }
+
+    // Preserve the permissions of the current file
+    if( written && fn.FileExists() )
+        KIPLATFORM::IO::DuplicatePermissions( aPath, tmpPath );
+
+    if( !written || !wxRenameFile( tmpPath, aPath, true ) )
+    {
+        // cleanup in case rename failed
+        wxRemoveFile( tmpPath );
+        return false;
+    }
+
+    return true;
+}
@@ -1430,7 +1430,7 @@ void EDA_BASE_FRAME::ClearUndoRedoList()
 
 void EDA_BASE_FRAME::PushCommandToUndoList( PICKED_ITEMS_LIST* aNewitem )
 {
-    m_undoList.PushCommand( aNewitem );
+    m_undoList.PushCommand( aNewitem, GetUndoCommandMemory( aNewitem ) );
 
     // Delete the extra items, if count max reached
     if( m_undoRedoCountMax > 0 )
@@ -1440,12 +1440,14 @@ void EDA_BASE_FRAME::PushCommandToUndoList( PICKED_ITEMS_LIST* aNewitem )
         if( extraitems > 0 )
             ClearUndoORRedoList( UNDO_LIST, extraitems );
     }
+
+    trimUndoRedoMemory( UNDO_LIST );
 }
 
 
 void EDA_BASE_FRAME::PushCommandToRedoList( PICKED_ITEMS_LIST* aNewitem )
 {
-    m_redoList.PushCommand( aNewitem );
+    m_redoList.PushCommand( aNewitem, GetUndoCommandMemory( aNewitem ) );
 
     // Delete the extra items, if count max reached
     if( m_undoRedoCountMax > 0 )
@@ -1455,6 +1457,28 @@ void EDA_BASE_FRAME::PushCommandToRedoList( PICKED_ITEMS_LIST* aNewitem )
         if( extraitems > 0 )
             ClearUndoORRedoList( REDO_LIST, extraitems );
     }
+
+    trimUndoRedoMemory( REDO_LIST );
+}
+
+
+void EDA_BASE_FRAME::trimUndoRedoMemory( UNDO_REDO_LIST aList )
+{
+    const size_t maxMemory = (size_t) ADVANCED_CFG::GetCfg().m_MaxUndoMemory * 1024 * 1024;
+
+    if( maxMemory == 0 )
+        return;
+
+    const UNDO_REDO_CONTAINER& list = ( aList == UNDO_LIST ) ? m_undoList : m_redoList;
+    size_t                     memory = list.GetMemory();
+    int                        count = 0;
+
+    // Drop from the oldest command; the newest one is kept whatever its size
+    while( memory > maxMemory && count < (int) list.m_CommandsList.size() - 1 )
+        memory -= list.GetCommandMemory( list.m_CommandsList[count++] );
+
+    if( count > 0 )
+        ClearUndoORRedoList( aList, count );
 }
 
 
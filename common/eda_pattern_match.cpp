@@ -243,6 +243,15 @@ bool EDA_PATTERN_MATCH_WILDCARD_ANCHORED::SetPattern( const wxString& aPattern )
 }
 
 
+EDA_PATTERN_MATCH_RELATIONAL::EDA_PATTERN_MATCH_RELATIONAL() :
+        m_relation( ANY ),
+        m_value( 0.0 ),
+        m_regex_description( R"((\w+)[=:]([-+]?[\d.]+)(\w*))", wxRE_ADVANCED ),
+        m_regex_search( R"(^(\w+)(<|<=|=|>=|>)([-+]?[\d.]*)(\w*)$)", wxRE_ADVANCED )
+{
+}
+
+
 bool EDA_PATTERN_MATCH_RELATIONAL::SetPattern( const wxString& aPattern )
 {
     bool matches = m_regex_search.Matches( aPattern );
@@ -365,10 +374,6 @@ int EDA_PATTERN_MATCH_RELATIONAL::FindOne( const wxString& aCandidate ) const
 }
 
 
-wxRegEx EDA_PATTERN_MATCH_RELATIONAL::m_regex_description(
-        R"((\w+)[=:]([-+]?[\d.]+)(\w*))", wxRE_ADVANCED );
-wxRegEx EDA_PATTERN_MATCH_RELATIONAL::m_regex_search(
-        R"(^(\w+)(<|<=|=|>=|>)([-+]?[\d.]*)(\w*)$)", wxRE_ADVANCED );
 const std::map<wxString, double> EDA_PATTERN_MATCH_RELATIONAL::m_units = {
     { wxS( "p" ),  1e-12 },
     { wxS( "n" ),  1e-9 },
@@ -505,6 +510,31 @@ wxString const& EDA_COMBINED_MATCHER::GetPattern() const
 }
 
 
+bool EDA_COMBINED_MATCHER::IsSubstringPattern() const
+{
+    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : m_matchers )
+    {
+        EDA_PATTERN_MATCH* m = matcher.get();
+
+        if( dynamic_cast<EDA_PATTERN_MATCH_SUBSTR*>( m ) )
+            continue;
+
+        // An unanchored wildcard without any wildcard character is a substring search too
+        if( dynamic_cast<EDA_PATTERN_MATCH_WILDCARD*>( m )
+                && !dynamic_cast<EDA_PATTERN_MATCH_WILDCARD_ANCHORED*>( m )
+                && m_pattern.Find( '*' ) == wxNOT_FOUND
+                && m_pattern.Find( '?' ) == wxNOT_FOUND )
+        {
+            continue;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+
 void EDA_COMBINED_MATCHER::AddMatcher( const wxString &aPattern,
                                        std::unique_ptr<EDA_PATTERN_MATCH> aMatcher )
 {
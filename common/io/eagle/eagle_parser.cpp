@@ -396,6 +396,18 @@ NODE_MAP MapChildren( wxXmlNode* aCurrentNode )
 }
 
 
+wxXmlNode* ReleaseXmlNode( wxXmlNode* aNode )
+{
+    wxXmlNode* next = aNode->GetNext();
+
+    if( wxXmlNode* parent = aNode->GetParent() )
+        parent->RemoveChild( aNode );
+
+    delete aNode;
+    return next;
+}
+
+
 VECTOR2I ConvertArcCenter( const VECTOR2I& aStart, const VECTOR2I& aEnd, double aAngle )
 {
     // Eagle give us start and end.
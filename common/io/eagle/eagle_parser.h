@@ -365,6 +365,18 @@ public:
  */
 NODE_MAP MapChildren( wxXmlNode* aCurrentNode );
 
+/**
+ * Detach \a aNode from its parent and delete it, with all its children.
+ *
+ * The importers release each node once it has been converted, so the XML tree shrinks while
+ * the KiCad objects are built instead of both being held until the end of the import.  Nodes
+ * must be released in document order, so the released node is always the first child of its
+ * parent and detaching it does not search the siblings.
+ *
+ * @return the node following \a aNode, to continue the iteration.
+ */
+wxXmlNode* ReleaseXmlNode( wxXmlNode* aNode );
+
 ///< Convert an Eagle curve end to a KiCad center for S_ARC
 VECTOR2I ConvertArcCenter( const VECTOR2I& aStart, const VECTOR2I& aEnd, double aAngle );
 
@@ -0,0 +1,42 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef JOB_PCB_CONVERT_H
+#define JOB_PCB_CONVERT_H
+
+#include <kicommon.h>
+#include <wx/string.h>
+#include "job.h"
+
+/**
+ * Load a board with one of the import plugins and save it in the KiCad format.
+ */
+class KICOMMON_API JOB_PCB_CONVERT : public JOB
+{
+public:
+    JOB_PCB_CONVERT( bool aIsCli );
+
+    wxString m_filename;
+    wxString m_outputFile;
+
+    ///< Name of the plugin to load the board with, empty to guess it from the file
+    wxString m_format;
+};
+
+#endif
@@ -23,12 +23,133 @@
 #include <lib_tree_model.h>
 
 #include <algorithm>
+#include <iterator>
 #include <eda_pattern_match.h>
 #include <lib_tree_item.h>
 #include <pgm_base.h>
 #include <string_utils.h>
 
 
+/**
+ * Call \a aFunc with the key of each trigram of \a aText.
+ */
+template <typename FUNC>
+static void forEachTrigram( const wxString& aText, FUNC&& aFunc )
+{
+    const std::wstring text = aText.ToStdWstring();
+
+    for( size_t ii = 0; ii + 2 < text.size(); ++ii )
+    {
+        aFunc( ( (uint64_t) (uint32_t) text[ii] << 42 )
+               | ( (uint64_t) (uint32_t) text[ii + 1] << 21 )
+               | (uint64_t) (uint32_t) text[ii + 2] );
+    }
+}
+
+
+bool LIB_TREE_SEARCH_INDEX::IsValidFor( const LIB_TREE_NODE::PTR_VECTOR& aNodes ) const
+{
+    if( m_nodes.empty() || m_nodes.size() != aNodes.size() )
+        return false;
+
+    for( size_t ii = 0; ii < aNodes.size(); ++ii )
+    {
+        if( m_nodes[ii] != aNodes[ii].get() )
+            return false;
+    }
+
+    return true;
+}
+
+
+void LIB_TREE_SEARCH_INDEX::Build( LIB_TREE_NODE::PTR_VECTOR& aNodes )
+{
+    Clear();
+
+    for( int ii = 0; ii < (int) aNodes.size(); ++ii )
+    {
+        LIB_TREE_NODE* node = aNodes[ii].get();
+
+        m_nodes.push_back( node );
+
+        for( SEARCH_TERM& term : node->m_SearchTerms )
+        {
+            // Same normalization as EDA_COMBINED_MATCHER::ScoreTerms()
+            if( !term.Normalized )
+            {
+                term.Text = term.Text.MakeLower().Trim( false ).Trim( true );
+                term.Normalized = true;
+            }
+
+            forEachTrigram( term.Text,
+                    [&]( uint64_t aTrigram )
+                    {
+                        std::vector<int>& nodes = m_trigrams[aTrigram];
+
+                        if( nodes.empty() || nodes.back() != ii )
+                            nodes.push_back( ii );
+                    } );
+        }
+    }
+}
+
+
+void LIB_TREE_SEARCH_INDEX::Clear()
+{
+    m_nodes.clear();
+    m_trigrams.clear();
+}
+
+
+void LIB_TREE_SEARCH_INDEX::FindCandidates( const wxString& aPattern,
+                                            std::vector<bool>& aCandidates ) const
+{
+    std::vector<const std::vector<int>*> lists;
+    bool                                 unknownTrigram = false;
+
+    aCandidates.clear();
+
+    forEachTrigram( aPattern,
+            [&]( uint64_t aTrigram )
+            {
+                auto it = m_trigrams.find( aTrigram );
+
+                if( it == m_trigrams.end() )
+                    unknownTrigram = true;
+                else
+                    lists.push_back( &it->second );
+            } );
+
+    if( lists.empty() && !unknownTrigram )
+        return;
+
+    aCandidates.assign( m_nodes.size(), false );
+
+    if( unknownTrigram )
+        return;
+
+    // Intersect the shortest lists first to keep the intermediate results small
+    std::sort( lists.begin(), lists.end(),
+               []( const std::vector<int>* a, const std::vector<int>* b )
+               {
+                   return a->size() < b->size();
+               } );
+
+    std::vector<int> result = *lists[0];
+    std::vector<int> next;
+
+    for( size_t ii = 1; ii < lists.size() && !result.empty(); ++ii )
+    {
+        next.clear();
+        std::set_intersection( result.begin(), result.end(), lists[ii]->begin(),
+                               lists[ii]->end(), std::back_inserter( next ) );
+        result.swap( next );
+    }
+
+    for( int idx : result )
+        aCandidates[idx] = true;
+}
+
 
 void LIB_TREE_NODE::ResetScore()
 {
@@ -236,16 +357,27 @@ void LIB_TREE_NODE_ITEM::Update( LIB_TREE_ITEM* aItem )
 
     for( int u = 1; u <= aItem->GetUnitCount(); ++u )
         AddUnit( aItem, u );
+
+    if( m_Parent && m_Parent->m_Type == LIBRARY )
+        static_cast<LIB_TREE_NODE_LIBRARY*>( m_Parent )->InvalidateSearchIndex();
 }
 
 
 void LIB_TREE_NODE_ITEM::UpdateScore( EDA_COMBINED_MATCHER* aMatcher, const wxString& aLib,
                                       std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
+{
+    UpdateScore( aMatcher, aLib, aFilter, true );
+}
+
+
+void LIB_TREE_NODE_ITEM::UpdateScore( EDA_COMBINED_MATCHER* aMatcher, const wxString& aLib,
+                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                                      bool aMayMatch )
 {
     // aMatcher test is additive, but if we don't match the given term at all, it nulls out
     if( aMatcher )
     {
-        int currentScore = aMatcher->ScoreTerms( m_SearchTerms );
+        int currentScore = aMayMatch ? aMatcher->ScoreTerms( m_SearchTerms ) : 0;
 
         if( m_Score >= 0 && currentScore > 0 )
             m_Score += currentScore;
@@ -290,11 +422,32 @@ LIB_TREE_NODE_ITEM& LIB_TREE_NODE_LIBRARY::AddItem( LIB_TREE_ITEM* aItem )
 void LIB_TREE_NODE_LIBRARY::UpdateScore( EDA_COMBINED_MATCHER* aMatcher, const wxString& aLib,
                                          std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
 {
-    int newScore = 0;
+    int               newScore = 0;
+    std::vector<bool> candidates;
 
-    for( std::unique_ptr<LIB_TREE_NODE>& child: m_Children )
+    // For plain text, only score the items whose search terms may contain it
+    if( aMatcher && aMatcher->IsSubstringPattern() )
     {
-        child->UpdateScore( aMatcher, aLib, aFilter );
+        if( !m_searchIndex.IsValidFor( m_Children ) )
+            m_searchIndex.Build( m_Children );
+
+        m_searchIndex.FindCandidates( aMatcher->GetPattern(), candidates );
+    }
+
+    for( size_t ii = 0; ii < m_Children.size(); ++ii )
+    {
+        LIB_TREE_NODE* child = m_Children[ii].get();
+
+        if( !candidates.empty() && child->m_Type == ITEM )
+        {
+            static_cast<LIB_TREE_NODE_ITEM*>( child )->UpdateScore( aMatcher, aLib, aFilter,
+                                                                    candidates[ii] );
+        }
+        else
+        {
+            child->UpdateScore( aMatcher, aLib, aFilter );
+        }
+
         newScore = std::max( newScore, child->m_Score );
     }
 
@@ -20,6 +20,8 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
+#include <core/thread_pool.h>
 #include <eda_base_frame.h>
 #include <eda_pattern_match.h>
 #include <kiface_base.h>
@@ -287,20 +289,18 @@ void LIB_TREE_MODEL_ADAPTER::UpdateSearchString( const wxString& aSearch, bool a
         while( tokenizer.HasMoreTokens() )
         {
             // First search for the full token, in case it appears in a search string
-            wxString             term = tokenizer.GetNextToken().Lower();
-            EDA_COMBINED_MATCHER termMatcher( term, CTX_LIBITEM );
+            wxString term = tokenizer.GetNextToken().Lower();
 
-            m_tree.UpdateScore( &termMatcher, wxEmptyString, firstTerm ? m_filter : nullptr );
+            scoreTree( term, wxEmptyString, firstTerm ? m_filter : nullptr );
             firstTerm = false;
 
             if( term.Contains( ":" ) )
             {
                 // Next search for the library:item_name
-                wxString             lib = term.BeforeFirst( ':' );
-                wxString             itemName = term.AfterFirst( ':' );
-                EDA_COMBINED_MATCHER itemNameMatcher( itemName, CTX_LIBITEM );
+                wxString lib = term.BeforeFirst( ':' );
+                wxString itemName = term.AfterFirst( ':' );
 
-                m_tree.UpdateScore( &itemNameMatcher, lib, nullptr );
+                scoreTree( itemName, lib, nullptr );
             }
             else
             {
@@ -346,6 +346,44 @@ void LIB_TREE_MODEL_ADAPTER::UpdateSearchString( const wxString& aSearch, bool a
 }
 
 
+void LIB_TREE_MODEL_ADAPTER::scoreTree( const wxString& aPattern, const wxString& aLib,
+                                        std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
+{
+    // Filters are free to keep state between calls, so filtered passes stay sequential
+    if( aFilter || m_tree.m_Children.size() < 2 )
+    {
+        EDA_COMBINED_MATCHER matcher( aPattern, CTX_LIBITEM );
+
+        m_tree.UpdateScore( &matcher, aLib, aFilter );
+        return;
+    }
+
+    thread_pool&               tp = GetKiCadThreadPool();
+    LIB_TREE_NODE::PTR_VECTOR& libs = m_tree.m_Children;
+    size_t                     blockCount = std::min<size_t>( libs.size(),
+                                                              tp.get_thread_count() );
+
+    // Libraries are scored independently.  Each block needs its own matcher as wxRegEx keeps
+    // the state of its last match.  The matchers are built here: compiling a pattern changes
+    // the global wxLog level, which must not happen from several threads at once.
+    std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>> matchers;
+    std::atomic<size_t>                                nextMatcher( 0 );
+
+    for( size_t ii = 0; ii < blockCount; ++ii )
+        matchers.push_back( std::make_unique<EDA_COMBINED_MATCHER>( aPattern, CTX_LIBITEM ) );
+
+    tp.parallelize_loop( libs.size(),
+            [&]( const int a, const int b )
+            {
+                EDA_COMBINED_MATCHER* matcher = matchers[nextMatcher++].get();
+
+                for( int ii = a; ii < b; ++ii )
+                    libs[ii]->UpdateScore( matcher, aLib, nullptr );
+            },
+            blockCount ).wait();
+}
+
+
 void LIB_TREE_MODEL_ADAPTER::AttachTo( wxDataViewCtrl* aDataViewCtrl )
 {
     m_widget = aDataViewCtrl;
@@ -41,6 +41,7 @@ const wxChar* const traceFindItem = wxT( "KICAD_FIND_ITEM" );
 const wxChar* const traceSchLegacyPlugin = wxT( "KICAD_SCH_LEGACY_PLUGIN" );
 const wxChar* const traceSchPlugin = wxT( "KICAD_SCH_PLUGIN" );
 const wxChar* const traceGedaPcbPlugin = wxT( "KICAD_GEDA_PLUGIN" );
+const wxChar* const traceAltiumPcbPlugin = wxT( "KICAD_ALTIUM_PCB_PLUGIN" );
 const wxChar* const traceKicadPcbPlugin = wxT( "KICAD_PCB_PLUGIN" );
 const wxChar* const tracePrinting = wxT( "KICAD_PRINT" );
 const wxChar* const traceAutoSave = wxT( "KICAD_AUTOSAVE" );
@@ -321,12 +321,20 @@ void UNDO_REDO_CONTAINER::ClearCommandList()
         delete m_CommandsList[ii];
 
     m_CommandsList.clear();
+    m_commandMemory.clear();
+    m_memory = 0;
 }
 
 
-void UNDO_REDO_CONTAINER::PushCommand( PICKED_ITEMS_LIST* aItem )
+void UNDO_REDO_CONTAINER::PushCommand( PICKED_ITEMS_LIST* aItem, size_t aMemory )
 {
     m_CommandsList.push_back( aItem );
+
+    if( aMemory > 0 )
+    {
+        m_commandMemory[aItem] = aMemory;
+        m_memory += aMemory;
+    }
 }
 
 
@@ -336,8 +344,43 @@ PICKED_ITEMS_LIST* UNDO_REDO_CONTAINER::PopCommand()
     {
         PICKED_ITEMS_LIST* item = m_CommandsList.back();
         m_CommandsList.pop_back();
+        forgetCommand( item );
+        return item;
+    }
+
+    return nullptr;
+}
+
+
+PICKED_ITEMS_LIST* UNDO_REDO_CONTAINER::PopOldestCommand()
+{
+    if( m_CommandsList.size() != 0 )
+    {
+        PICKED_ITEMS_LIST* item = m_CommandsList.front();
+        m_CommandsList.erase( m_CommandsList.begin() );
+        forgetCommand( item );
         return item;
     }
 
     return nullptr;
 }
+
+
+size_t UNDO_REDO_CONTAINER::GetCommandMemory( const PICKED_ITEMS_LIST* aCommand ) const
+{
+    auto it = m_commandMemory.find( aCommand );
+
+    return it != m_commandMemory.end() ? it->second : 0;
+}
+
+
+void UNDO_REDO_CONTAINER::forgetCommand( const PICKED_ITEMS_LIST* aCommand )
+{
+    auto it = m_commandMemory.find( aCommand );
+
+    if( it != m_commandMemory.end() )
+    {
+        m_memory -= it->second;
+        m_commandMemory.erase( it );
+    }
+}
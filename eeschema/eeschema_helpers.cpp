@@ -91,9 +91,9 @@ SCHEMATIC* EESCHEMA_HELPERS::LoadSchematic( wxString& aFileName, bool aSetActive
 
 
 SCHEMATIC* EESCHEMA_HELPERS::LoadSchematic( wxString& aFileName, SCH_IO_MGR::SCH_FILE_T aFormat,
-                                            bool aSetActive )
+                                            bool aSetActive, const wxString& aProjectPath )
 {
-    wxFileName pro = aFileName;
+    wxFileName pro = aProjectPath.IsEmpty() ? aFileName : aProjectPath;
     pro.SetExt( FILEEXT::ProjectFileExtension );
     pro.MakeAbsolute();
     wxString projectPath = pro.GetFullPath();
@@ -106,7 +106,7 @@ SCHEMATIC* EESCHEMA_HELPERS::LoadSchematic( wxString& aFileName, SCH_IO_MGR::SCH
 
     if( !project )
     {
-        if( wxFileExists( projectPath ) )
+        if( wxFileExists( projectPath ) || !aProjectPath.IsEmpty() )
         {
             GetSettingsManager()->LoadProject( projectPath, aSetActive );
             project = GetSettingsManager()->GetProject( projectPath );
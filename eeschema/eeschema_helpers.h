@@ -45,8 +45,16 @@ public:
     static void              SetSchEditFrame( SCH_EDIT_FRAME* aSchEditFrame );
     static PROJECT*          GetDefaultProject();
     static SCHEMATIC*        LoadSchematic( wxString& aFileName, bool aSetActive );
+
+    /**
+     * Load a schematic in the project next to it, or in \a aProjectPath when it is given.
+     *
+     * The project named by \a aProjectPath is created when it doesn't exist yet.  Importers write
+     * the libraries they generate in the project folder.
+     */
     static SCHEMATIC*        LoadSchematic( wxString& aFileName, SCH_IO_MGR::SCH_FILE_T aFormat,
-                                            bool aSetActive );
+                                            bool aSetActive,
+                                            const wxString& aProjectPath = wxEmptyString );
 
 
 private:
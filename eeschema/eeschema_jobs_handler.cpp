@@ -28,13 +28,18 @@
 #include <jobs/job_export_sch_pythonbom.h>
 #include <jobs/job_export_sch_netlist.h>
 #include <jobs/job_export_sch_plot.h>
+#include <jobs/job_sch_convert.h>
 #include <jobs/job_sch_erc.h>
 #include <jobs/job_sym_export_svg.h>
 #include <jobs/job_sym_upgrade.h>
 #include <schematic.h>
+#include <sch_screen.h>
+#include <sch_sheet.h>
 #include <wx/dir.h>
 #include <wx/file.h>
+#include <map>
 #include <memory>
+#include <set>
 #include <connection_graph.h>
 #include "eeschema_helpers.h"
 #include <kiway.h>
@@ -83,6 +88,8 @@ EESCHEMA_JOBS_HANDLER::EESCHEMA_JOBS_HANDLER( KIWAY* aKiway ) :
               std::bind( &EESCHEMA_JOBS_HANDLER::JobSymExportSvg, this, std::placeholders::_1 ) );
     Register( "erc",
               std::bind( &EESCHEMA_JOBS_HANDLER::JobSchErc, this, std::placeholders::_1 ) );
+    Register( "schconvert",
+              std::bind( &EESCHEMA_JOBS_HANDLER::JobSchConvert, this, std::placeholders::_1 ) );
 }
 
 
@@ -1011,6 +1018,132 @@ int EESCHEMA_JOBS_HANDLER::JobSchErc( JOB* aJob )
 }
 
 
+int EESCHEMA_JOBS_HANDLER::JobSchConvert( JOB* aJob )
+{
+    JOB_SCH_CONVERT* convertJob = dynamic_cast<JOB_SCH_CONVERT*>( aJob );
+
+    if( !convertJob )
+        return CLI::EXIT_CODES::ERR_UNKNOWN;
+
+    SCH_IO_MGR::SCH_FILE_T fileType = SCH_IO_MGR::SCH_FILE_UNKNOWN;
+
+    if( convertJob->m_format.IsEmpty() )
+        fileType = SCH_IO_MGR::GuessPluginTypeFromSchPath( convertJob->m_filename );
+    else
+        fileType = SCH_IO_MGR::EnumFromStr( convertJob->m_format );
+
+    if( fileType == SCH_IO_MGR::SCH_FILE_UNKNOWN )
+    {
+        m_reporter->Report( wxString::Format( _( "No importer can read '%s'\n" ),
+                                              convertJob->m_filename ),
+                            RPT_SEVERITY_ERROR );
+        return CLI::EXIT_CODES::ERR_INVALID_INPUT_FILE;
+    }
+
+    if( convertJob->m_outputFile.IsEmpty() )
+    {
+        wxFileName fn = convertJob->m_filename;
+        fn.SetExt( FILEEXT::KiCadSchematicFileExtension );
+
+        convertJob->m_outputFile = fn.GetFullPath();
+    }
+
+    if( aJob->IsCli() )
+    {
+        m_reporter->Report( wxString::Format( _( "Loading schematic with the %s importer\n" ),
+                                              SCH_IO_MGR::ShowType( fileType ) ),
+                            RPT_SEVERITY_INFO );
+    }
+
+    wxFileName outputFn = convertJob->m_outputFile;
+    outputFn.MakeAbsolute();
+
+    // The importers write the symbol libraries they generate, and the symbol library table
+    // referring to them, in the project folder: the project has to be the one of the output.
+    wxFileName projectFn = outputFn;
+    projectFn.SetExt( FILEEXT::ProjectFileExtension );
+
+    SCHEMATIC* sch = EESCHEMA_HELPERS::LoadSchematic( convertJob->m_filename, fileType, true,
+                                                      projectFn.GetFullPath() );
+
+    if( sch == nullptr )
+    {
+        m_reporter->Report( _( "Failed to load schematic file\n" ), RPT_SEVERITY_ERROR );
+        return CLI::EXIT_CODES::ERR_INVALID_INPUT_FILE;
+    }
+
+    sch->Root().SetFileName( outputFn.GetFullName() );
+    sch->RootScreen()->SetFileName( outputFn.GetFullPath() );
+
+    // Every sheet is written once, next to the root sheet, whatever file the importer named it.
+    // The sheets referring to a screen have to follow it before their parent sheet is saved.
+    std::map<SCH_SCREEN*, wxString> screenFiles;
+    std::set<wxString>              usedFiles = { outputFn.GetFullPath() };
+
+    for( const SCH_SHEET_PATH& sheetPath : sch->GetSheets() )
+    {
+        SCH_SHEET*  sheet = sheetPath.Last();
+        SCH_SCREEN* screen = sheet->GetScreen();
+
+        if( !screen || screen == sch->RootScreen() )
+            continue;
+
+        auto it = screenFiles.find( screen );
+
+        if( it == screenFiles.end() )
+        {
+            wxFileName fn = screen->GetFileName();
+            fn.SetPath( outputFn.GetPath() );
+            fn.SetExt( FILEEXT::KiCadSchematicFileExtension );
+
+            if( !usedFiles.insert( fn.GetFullPath() ).second )
+            {
+                m_reporter->Report( wxString::Format( _( "Sheet file '%s' would be written "
+                                                         "more than once\n" ),
+                                                      fn.GetFullPath() ),
+                                    RPT_SEVERITY_ERROR );
+                return CLI::EXIT_CODES::ERR_INVALID_OUTPUT_CONFLICT;
+            }
+
+            screen->SetFileName( fn.GetFullPath() );
+            it = screenFiles.emplace( screen, fn.GetFullName() ).first;
+        }
+
+        sheet->SetFileName( it->second );
+    }
+
+    std::set<SCH_SCREEN*> savedScreens;
+
+    for( const SCH_SHEET_PATH& sheetPath : sch->GetSheets() )
+    {
+        SCH_SHEET*  sheet = sheetPath.Last();
+        SCH_SCREEN* screen = sheet->GetScreen();
+
+        if( !screen || !savedScreens.insert( screen ).second )
+            continue;
+
+        try
+        {
+            IO_RELEASER<SCH_IO> pi( SCH_IO_MGR::FindPlugin( SCH_IO_MGR::SCH_KICAD ) );
+            pi->SaveSchematicFile( screen->GetFileName(), sheet, sch );
+        }
+        catch( const IO_ERROR& ioe )
+        {
+            m_reporter->Report( wxString::Format( _( "Error saving schematic file '%s'.\n%s\n" ),
+                                                  screen->GetFileName(), ioe.What() ),
+                                RPT_SEVERITY_ERROR );
+            return CLI::EXIT_CODES::ERR_UNKNOWN;
+        }
+    }
+
+    m_reporter->Report( wxString::Format( _( "Saved schematic to '%s'\n" ),
+                                          outputFn.GetFullPath() ),
+                        RPT_SEVERITY_ACTION );
+
+    return CLI::EXIT_CODES::SUCCESS;
+}
+
+
 DS_PROXY_VIEW_ITEM* EESCHEMA_JOBS_HANDLER::getDrawingSheetProxyView( SCHEMATIC* aSch )
 {
     DS_PROXY_VIEW_ITEM* drawingSheet =
@@ -49,6 +49,7 @@ public:
     int JobSchErc( JOB* aJob );
     int JobSymUpgrade( JOB* aJob );
     int JobSymExportSvg( JOB* aJob );
+    int JobSchConvert( JOB* aJob );
 
     /**
      * Configure the SCH_RENDER_SETTINGS object with the correct data to be used with plotting.
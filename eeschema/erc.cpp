@@ -30,6 +30,7 @@
 #include "kiface_ids.h"
 #include <advanced_config.h>
 #include <common.h>     // for ExpandEnvVarSubstitutions
+#include <core/thread_pool.h>
 #include <erc.h>
 #include <erc_sch_pin_context.h>
 #include <gal/graphics_abstraction_layer.h>
@@ -607,70 +608,86 @@ int ERC_TESTER::TestMissingNetclasses()
 
 int ERC_TESTER::TestNoConnectPins()
 {
-    int err_count = 0;
+    SCH_SHEET_LIST sheets = m_schematic->GetSheets();
 
-    for( const SCH_SHEET_PATH& sheet : m_schematic->GetSheets() )
-    {
-        std::map<VECTOR2I, std::vector<SCH_ITEM*>> pinMap;
+    // Sheets are independent here, so shard them across the thread pool
+    std::vector<std::vector<ERC_MARKER_TARGET>> sheetMarkers( sheets.size() );
 
-        auto addOther =
-                [&]( const VECTOR2I& pt, SCH_ITEM* aOther )
-                {
-                    if( pinMap.count( pt ) )
-                        pinMap[pt].emplace_back( aOther );
-                };
+    auto testSheet =
+            [&]( size_t aSheetIdx )
+            {
+                const SCH_SHEET_PATH&                      sheet = sheets[aSheetIdx];
+                std::vector<ERC_MARKER_TARGET>&            markers = sheetMarkers[aSheetIdx];
+                std::map<VECTOR2I, std::vector<SCH_ITEM*>> pinMap;
 
-        for( SCH_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
-        {
-            SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+                auto addOther =
+                        [&]( const VECTOR2I& pt, SCH_ITEM* aOther )
+                        {
+                            if( pinMap.count( pt ) )
+                                pinMap[pt].emplace_back( aOther );
+                        };
 
-            for( SCH_PIN* pin : symbol->GetPins( &sheet ) )
-            {
-                if( pin->GetLibPin()->GetType() == ELECTRICAL_PINTYPE::PT_NC )
-                    pinMap[pin->GetPosition()].emplace_back( pin );
-            }
-        }
+                for( SCH_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
+                {
+                    SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
 
-        for( SCH_ITEM* item : sheet.LastScreen()->Items() )
-        {
-            if( item->Type() == SCH_SYMBOL_T )
-            {
-                SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+                    for( SCH_PIN* pin : symbol->GetPins( &sheet ) )
+                    {
+                        if( pin->GetLibPin()->GetType() == ELECTRICAL_PINTYPE::PT_NC )
+                            pinMap[pin->GetPosition()].emplace_back( pin );
+                    }
+                }
 
-                for( SCH_PIN* pin : symbol->GetPins( &sheet ) )
+                for( SCH_ITEM* item : sheet.LastScreen()->Items() )
                 {
-                    if( pin->GetLibPin()->GetType() != ELECTRICAL_PINTYPE::PT_NC )
-                        addOther( pin->GetPosition(), pin );
+                    if( item->Type() == SCH_SYMBOL_T )
+                    {
+                        SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+
+                        for( SCH_PIN* pin : symbol->GetPins( &sheet ) )
+                        {
+                            if( pin->GetLibPin()->GetType() != ELECTRICAL_PINTYPE::PT_NC )
+                                addOther( pin->GetPosition(), pin );
+                        }
+                    }
+                    else if( item->IsConnectable() )
+                    {
+                        for( const VECTOR2I& pt : item->GetConnectionPoints() )
+                            addOther( pt, item );
+                    }
                 }
-            }
-            else if( item->IsConnectable() )
-            {
-                for( const VECTOR2I& pt : item->GetConnectionPoints() )
-                    addOther( pt, item );
-            }
-        }
 
-        for( const std::pair<const VECTOR2I, std::vector<SCH_ITEM*>>& pair : pinMap )
-        {
-            if( pair.second.size() > 1 )
-            {
-                err_count++;
+                for( const std::pair<const VECTOR2I, std::vector<SCH_ITEM*>>& pair : pinMap )
+                {
+                    if( pair.second.size() > 1 )
+                    {
+                        std::shared_ptr<ERC_ITEM> ercItem =
+                                ERC_ITEM::Create( ERCE_NOCONNECT_CONNECTED );
+
+                        ercItem->SetItems( pair.second[0], pair.second[1],
+                                           pair.second.size() > 2 ? pair.second[2] : nullptr,
+                                           pair.second.size() > 3 ? pair.second[3] : nullptr );
+                        ercItem->SetErrorMessage(
+                                _( "Pin with 'no connection' type is connected" ) );
+                        ercItem->SetSheetSpecificPath( sheet );
 
-                std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_NOCONNECT_CONNECTED );
+                        SCH_MARKER* marker = new SCH_MARKER( ercItem, pair.first );
+                        markers.emplace_back( sheet.LastScreen(), marker );
+                    }
+                }
+            };
 
-                ercItem->SetItems( pair.second[0], pair.second[1],
-                                   pair.second.size() > 2 ? pair.second[2] : nullptr,
-                                   pair.second.size() > 3 ? pair.second[3] : nullptr );
-                ercItem->SetErrorMessage( _( "Pin with 'no connection' type is connected" ) );
-                ercItem->SetSheetSpecificPath( sheet );
+    thread_pool& tp = GetKiCadThreadPool();
 
-                SCH_MARKER* marker = new SCH_MARKER( ercItem, pair.first );
-                sheet.LastScreen()->Append( marker );
-            }
-        }
-    }
+    tp.push_loop( sheets.size(),
+            [&]( const int a, const int b )
+            {
+                for( int ii = a; ii < b; ++ii )
+                    testSheet( ii );
+            } );
+    tp.wait_for_tasks();
 
-    return err_count;
+    return appendMarkers( sheetMarkers );
 }
 
 
@@ -679,134 +696,161 @@ int ERC_TESTER::TestPinToPin()
     ERC_SETTINGS&  settings = m_schematic->ErcSettings();
     const NET_MAP& nets     = m_schematic->ConnectionGraph()->GetNetMap();
 
-    int errors = 0;
+    std::vector<const std::vector<CONNECTION_SUBGRAPH*>*> netList;
 
-    for( const std::pair<NET_NAME_CODE_CACHE_KEY, std::vector<CONNECTION_SUBGRAPH*>> net : nets )
-    {
-        std::vector<ERC_SCH_PIN_CONTEXT>           pins;
-        std::unordered_map<EDA_ITEM*, SCH_SCREEN*> pinToScreenMap;
-        bool has_noconnect = false;
+    netList.reserve( nets.size() );
 
-        for( CONNECTION_SUBGRAPH* subgraph: net.second )
-        {
-            if( subgraph->GetNoConnect() )
-                has_noconnect = true;
+    for( const auto& [ key, subgraphs ] : nets )
+        netList.push_back( &subgraphs );
 
-            for( SCH_ITEM* item : subgraph->GetItems() )
+    // Each net is tested independently, so the nets are sharded across the thread pool.  The
+    // markers are collected per net and only appended to their screens once all the workers
+    // are done, in net order, so the result doesn't depend on the thread scheduling.
+    std::vector<std::vector<ERC_MARKER_TARGET>> netMarkers( netList.size() );
+
+    auto testNet =
+            [&]( size_t aNetIdx )
             {
-                if( item->Type() == SCH_PIN_T )
-                {
-                    pins.emplace_back( static_cast<SCH_PIN*>( item ), subgraph->GetSheet() );
-                    pinToScreenMap[item] = subgraph->GetSheet().LastScreen();
-                }
-            }
-        }
+                const std::vector<CONNECTION_SUBGRAPH*>&   net = *netList[aNetIdx];
+                std::vector<ERC_MARKER_TARGET>&            markers = netMarkers[aNetIdx];
+                std::vector<ERC_SCH_PIN_CONTEXT>           pins;
+                std::unordered_map<EDA_ITEM*, SCH_SCREEN*> pinToScreenMap;
+                bool has_noconnect = false;
 
-        ERC_SCH_PIN_CONTEXT needsDriver;
-        bool                hasDriver = false;
+                for( CONNECTION_SUBGRAPH* subgraph: net )
+                {
+                    if( subgraph->GetNoConnect() )
+                        has_noconnect = true;
 
-        // We need different drivers for power nets and normal nets.
-        // A power net has at least one pin having the ELECTRICAL_PINTYPE::PT_POWER_IN
-        // and power nets can be driven only by ELECTRICAL_PINTYPE::PT_POWER_OUT pins
-        bool     ispowerNet  = false;
+                    for( SCH_ITEM* item : subgraph->GetItems() )
+                    {
+                        if( item->Type() == SCH_PIN_T )
+                        {
+                            pins.emplace_back( static_cast<SCH_PIN*>( item ),
+                                               subgraph->GetSheet() );
+                            pinToScreenMap[item] = subgraph->GetSheet().LastScreen();
+                        }
+                    }
+                }
 
-        for( ERC_SCH_PIN_CONTEXT& refPin : pins )
-        {
-            if( refPin.Pin()->GetType() == ELECTRICAL_PINTYPE::PT_POWER_IN )
-            {
-                ispowerNet = true;
-                break;
-            }
-        }
+                ERC_SCH_PIN_CONTEXT needsDriver;
+                bool                hasDriver = false;
 
-        for( auto refIt = pins.begin(); refIt != pins.end(); ++refIt )
-        {
-            ERC_SCH_PIN_CONTEXT& refPin = *refIt;
-            ELECTRICAL_PINTYPE refType = refPin.Pin()->GetType();
+                // We need different drivers for power nets and normal nets.
+                // A power net has at least one pin having the ELECTRICAL_PINTYPE::PT_POWER_IN
+                // and power nets can be driven only by ELECTRICAL_PINTYPE::PT_POWER_OUT pins
+                bool     ispowerNet  = false;
 
-            if( DrivenPinTypes.count( refType ) )
-            {
-                // needsDriver will be the pin shown in the error report eventually, so try to
-                // upgrade to a "better" pin if possible: something visible and only a power symbol
-                // if this net needs a power driver
-                if( !needsDriver.Pin()
-                    || ( !needsDriver.Pin()->IsVisible() && refPin.Pin()->IsVisible() )
-                    || ( ispowerNet
-                                 != ( needsDriver.Pin()->GetType()
-                                      == ELECTRICAL_PINTYPE::PT_POWER_IN )
-                         && ispowerNet == ( refType == ELECTRICAL_PINTYPE::PT_POWER_IN ) ) )
+                for( ERC_SCH_PIN_CONTEXT& refPin : pins )
                 {
-                    needsDriver = refPin;
+                    if( refPin.Pin()->GetType() == ELECTRICAL_PINTYPE::PT_POWER_IN )
+                    {
+                        ispowerNet = true;
+                        break;
+                    }
                 }
-            }
 
-            if( ispowerNet )
-                hasDriver |= ( DrivingPowerPinTypes.count( refType ) != 0 );
-            else
-                hasDriver |= ( DrivingPinTypes.count( refType ) != 0 );
+                for( auto refIt = pins.begin(); refIt != pins.end(); ++refIt )
+                {
+                    ERC_SCH_PIN_CONTEXT& refPin = *refIt;
+                    ELECTRICAL_PINTYPE refType = refPin.Pin()->GetType();
 
-            for( auto testIt = refIt + 1; testIt != pins.end(); ++testIt )
-            {
-                ERC_SCH_PIN_CONTEXT& testPin = *testIt;
+                    if( DrivenPinTypes.count( refType ) )
+                    {
+                        // needsDriver will be the pin shown in the error report eventually, so
+                        // try to upgrade to a "better" pin if possible: something visible and
+                        // only a power symbol if this net needs a power driver
+                        if( !needsDriver.Pin()
+                            || ( !needsDriver.Pin()->IsVisible() && refPin.Pin()->IsVisible() )
+                            || ( ispowerNet
+                                         != ( needsDriver.Pin()->GetType()
+                                              == ELECTRICAL_PINTYPE::PT_POWER_IN )
+                                 && ispowerNet == ( refType == ELECTRICAL_PINTYPE::PT_POWER_IN ) ) )
+                        {
+                            needsDriver = refPin;
+                        }
+                    }
 
-                // Multiple pins in the same symbol that share a type,
-                // name and position are considered
-                // "stacked" and shouldn't trigger ERC errors
-                if( refPin.Pin()->IsStacked( testPin.Pin() ) && refPin.Sheet() == testPin.Sheet() )
-                    continue;
+                    if( ispowerNet )
+                        hasDriver |= ( DrivingPowerPinTypes.count( refType ) != 0 );
+                    else
+                        hasDriver |= ( DrivingPinTypes.count( refType ) != 0 );
 
-                ELECTRICAL_PINTYPE testType = testPin.Pin()->GetType();
+                    for( auto testIt = refIt + 1; testIt != pins.end(); ++testIt )
+                    {
+                        ERC_SCH_PIN_CONTEXT& testPin = *testIt;
 
-                if( ispowerNet )
-                    hasDriver |= ( DrivingPowerPinTypes.count( testType ) != 0 );
-                else
-                    hasDriver |= ( DrivingPinTypes.count( testType ) != 0 );
+                        // Multiple pins in the same symbol that share a type,
+                        // name and position are considered
+                        // "stacked" and shouldn't trigger ERC errors
+                        if( refPin.Pin()->IsStacked( testPin.Pin() )
+                                && refPin.Sheet() == testPin.Sheet() )
+                        {
+                            continue;
+                        }
 
-                PIN_ERROR erc = settings.GetPinMapValue( refType, testType );
+                        ELECTRICAL_PINTYPE testType = testPin.Pin()->GetType();
 
-                if( erc != PIN_ERROR::OK && settings.IsTestEnabled( ERCE_PIN_TO_PIN_WARNING ) )
-                {
-                    std::shared_ptr<ERC_ITEM> ercItem =
-                            ERC_ITEM::Create( erc == PIN_ERROR::WARNING ? ERCE_PIN_TO_PIN_WARNING :
-                                                                          ERCE_PIN_TO_PIN_ERROR );
-                    ercItem->SetItems( refPin.Pin(), testPin.Pin() );
-                    ercItem->SetSheetSpecificPath( refPin.Sheet() );
-                    ercItem->SetItemsSheetPaths( refPin.Sheet(), testPin.Sheet() );
-
-                    ercItem->SetErrorMessage(
-                            wxString::Format( _( "Pins of type %s and %s are connected" ),
-                                              ElectricalPinTypeGetText( refType ),
-                                              ElectricalPinTypeGetText( testType ) ) );
-
-                    SCH_MARKER* marker = new SCH_MARKER( ercItem,
-                                                         refPin.Pin()->GetTransformedPosition() );
-                    pinToScreenMap[refPin.Pin()]->Append( marker );
-                    errors++;
+                        if( ispowerNet )
+                            hasDriver |= ( DrivingPowerPinTypes.count( testType ) != 0 );
+                        else
+                            hasDriver |= ( DrivingPinTypes.count( testType ) != 0 );
+
+                        PIN_ERROR erc = settings.GetPinMapValue( refType, testType );
+
+                        if( erc != PIN_ERROR::OK
+                                && settings.IsTestEnabled( ERCE_PIN_TO_PIN_WARNING ) )
+                        {
+                            std::shared_ptr<ERC_ITEM> ercItem =
+                                    ERC_ITEM::Create( erc == PIN_ERROR::WARNING
+                                                              ? ERCE_PIN_TO_PIN_WARNING
+                                                              : ERCE_PIN_TO_PIN_ERROR );
+                            ercItem->SetItems( refPin.Pin(), testPin.Pin() );
+                            ercItem->SetSheetSpecificPath( refPin.Sheet() );
+                            ercItem->SetItemsSheetPaths( refPin.Sheet(), testPin.Sheet() );
+
+                            ercItem->SetErrorMessage(
+                                    wxString::Format( _( "Pins of type %s and %s are connected" ),
+                                                      ElectricalPinTypeGetText( refType ),
+                                                      ElectricalPinTypeGetText( testType ) ) );
+
+                            VECTOR2I    pos = refPin.Pin()->GetTransformedPosition();
+                            SCH_MARKER* marker = new SCH_MARKER( ercItem, pos );
+                            markers.emplace_back( pinToScreenMap[refPin.Pin()], marker );
+                        }
+                    }
                 }
-            }
-        }
 
-        if( needsDriver.Pin() && !hasDriver && !has_noconnect )
-        {
-            int err_code = ispowerNet ? ERCE_POWERPIN_NOT_DRIVEN : ERCE_PIN_NOT_DRIVEN;
+                if( needsDriver.Pin() && !hasDriver && !has_noconnect )
+                {
+                    int err_code = ispowerNet ? ERCE_POWERPIN_NOT_DRIVEN : ERCE_PIN_NOT_DRIVEN;
 
-            if( settings.IsTestEnabled( err_code ) )
-            {
-                std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( err_code );
+                    if( settings.IsTestEnabled( err_code ) )
+                    {
+                        std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( err_code );
 
-                ercItem->SetItems( needsDriver.Pin() );
-                ercItem->SetSheetSpecificPath( needsDriver.Sheet() );
-                ercItem->SetItemsSheetPaths( needsDriver.Sheet() );
+                        ercItem->SetItems( needsDriver.Pin() );
+                        ercItem->SetSheetSpecificPath( needsDriver.Sheet() );
+                        ercItem->SetItemsSheetPaths( needsDriver.Sheet() );
 
-                SCH_MARKER* marker = new SCH_MARKER( ercItem,
-                                                     needsDriver.Pin()->GetTransformedPosition() );
-                pinToScreenMap[needsDriver.Pin()]->Append( marker );
-                errors++;
-            }
-        }
-    }
+                        VECTOR2I    pos = needsDriver.Pin()->GetTransformedPosition();
+                        SCH_MARKER* marker = new SCH_MARKER( ercItem, pos );
+                        markers.emplace_back( pinToScreenMap[needsDriver.Pin()], marker );
+                    }
+                }
+            };
 
-    return errors;
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.push_loop( netList.size(),
+            [&]( const int a, const int b )
+            {
+                for( int ii = a; ii < b; ++ii )
+                    testNet( ii );
+            } );
+    tp.wait_for_tasks();
+
+    return appendMarkers( netMarkers );
 }
 
 
@@ -1119,64 +1163,78 @@ int ERC_TESTER::TestOffGridEndpoints()
 {
     const int gridSize = m_schematic->Settings().m_ConnectionGridSize;
 
-    SCH_SCREENS screens( m_schematic->Root() );
-    int         err_count = 0;
+    SCH_SCREENS              screens( m_schematic->Root() );
+    std::vector<SCH_SCREEN*> screenList;
 
     for( SCH_SCREEN* screen = screens.GetFirst(); screen != nullptr; screen = screens.GetNext() )
-    {
-        std::vector<SCH_MARKER*> markers;
+        screenList.push_back( screen );
 
-        for( SCH_ITEM* item : screen->Items() )
-        {
-            if( item->Type() == SCH_LINE_T && item->IsConnectable() )
-            {
-                SCH_LINE* line = static_cast<SCH_LINE*>( item );
+    // Screens are independent here, so shard them across the thread pool
+    std::vector<std::vector<ERC_MARKER_TARGET>> screenMarkers( screenList.size() );
 
-                if( ( line->GetStartPoint().x % gridSize ) != 0
-                        || ( line->GetStartPoint().y % gridSize ) != 0 )
-                {
-                    std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                    ercItem->SetItems( line );
+    auto testScreen =
+            [&]( size_t aScreenIdx )
+            {
+                SCH_SCREEN*                     screen = screenList[aScreenIdx];
+                std::vector<ERC_MARKER_TARGET>& markers = screenMarkers[aScreenIdx];
 
-                    markers.emplace_back( new SCH_MARKER( ercItem, line->GetStartPoint() ) );
-                }
-                else if( ( line->GetEndPoint().x % gridSize ) != 0
-                            || ( line->GetEndPoint().y % gridSize ) != 0 )
+                for( SCH_ITEM* item : screen->Items() )
                 {
-                    std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                    ercItem->SetItems( line );
+                    if( item->Type() == SCH_LINE_T && item->IsConnectable() )
+                    {
+                        SCH_LINE* line = static_cast<SCH_LINE*>( item );
 
-                    markers.emplace_back( new SCH_MARKER( ercItem, line->GetEndPoint() ) );
-                }
-            }
-            else if( item->Type() == SCH_SYMBOL_T )
-            {
-                SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+                        if( ( line->GetStartPoint().x % gridSize ) != 0
+                                || ( line->GetStartPoint().y % gridSize ) != 0 )
+                        {
+                            auto ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                            ercItem->SetItems( line );
 
-                for( SCH_PIN* pin : symbol->GetPins( nullptr ) )
-                {
-                    VECTOR2I pinPos = pin->GetTransformedPosition();
+                            markers.emplace_back( screen, new SCH_MARKER( ercItem,
+                                                                          line->GetStartPoint() ) );
+                        }
+                        else if( ( line->GetEndPoint().x % gridSize ) != 0
+                                    || ( line->GetEndPoint().y % gridSize ) != 0 )
+                        {
+                            auto ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                            ercItem->SetItems( line );
 
-                    if( ( pinPos.x % gridSize ) != 0 || ( pinPos.y % gridSize ) != 0 )
+                            markers.emplace_back( screen, new SCH_MARKER( ercItem,
+                                                                          line->GetEndPoint() ) );
+                        }
+                    }
+                    else if( item->Type() == SCH_SYMBOL_T )
                     {
-                        auto ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                        ercItem->SetItems( pin );
+                        SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
 
-                        markers.emplace_back( new SCH_MARKER( ercItem, pinPos ) );
-                        break;
+                        for( SCH_PIN* pin : symbol->GetPins( nullptr ) )
+                        {
+                            VECTOR2I pinPos = pin->GetTransformedPosition();
+
+                            if( ( pinPos.x % gridSize ) != 0 || ( pinPos.y % gridSize ) != 0 )
+                            {
+                                auto ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                                ercItem->SetItems( pin );
+
+                                markers.emplace_back( screen, new SCH_MARKER( ercItem, pinPos ) );
+                                break;
+                            }
+                        }
                     }
                 }
-            }
-        }
+            };
 
-        for( SCH_MARKER* marker : markers )
-        {
-            screen->Append( marker );
-            err_count += 1;
-        }
-    }
+    thread_pool& tp = GetKiCadThreadPool();
 
-    return err_count;
+    tp.push_loop( screenList.size(),
+            [&]( const int a, const int b )
+            {
+                for( int ii = a; ii < b; ++ii )
+                    testScreen( ii );
+            } );
+    tp.wait_for_tasks();
+
+    return appendMarkers( screenMarkers );
 }
 
 
@@ -1231,6 +1289,23 @@ int ERC_TESTER::TestSimModelIssues()
 }
 
 
+int ERC_TESTER::appendMarkers( const std::vector<std::vector<ERC_MARKER_TARGET>>& aShards )
+{
+    int err_count = 0;
+
+    for( const std::vector<ERC_MARKER_TARGET>& shard : aShards )
+    {
+        for( const auto& [ screen, marker ] : shard )
+        {
+            screen->Append( marker );
+            err_count += 1;
+        }
+    }
+
+    return err_count;
+}
+
+
 void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aEditFrame,
                            KIFACE* aCvPcb, PROJECT* aProject, PROGRESS_REPORTER* aProgressReporter )
 {
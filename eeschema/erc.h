@@ -27,9 +27,12 @@
 #define ERC_H
 
 #include <erc_settings.h>
+#include <vector>
 
 
 class SCH_SHEET_LIST;
+class SCH_SCREEN;
+class SCH_MARKER;
 class SCHEMATIC;
 class DS_PROXY_VIEW_ITEM;
 class SCH_EDIT_FRAME;
@@ -145,6 +148,17 @@ public:
                    KIFACE* aCvPcb, PROJECT* aProject, PROGRESS_REPORTER* aProgressReporter );
 
 private:
+    /// A marker produced by a (possibly multi-threaded) test, and the screen it belongs to.
+    typedef std::pair<SCH_SCREEN*, SCH_MARKER*> ERC_MARKER_TARGET;
+
+    /**
+     * Append the markers collected by the shards of a multi-threaded test to their screens.
+     *
+     * Shards are merged in order so that the result doesn't depend on thread scheduling.
+     *
+     * @return the number of markers appended.
+     */
+    static int appendMarkers( const std::vector<std::vector<ERC_MARKER_TARGET>>& aShards );
 
     SCHEMATIC* m_schematic;
 };
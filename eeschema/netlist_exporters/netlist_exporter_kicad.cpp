@@ -25,6 +25,7 @@
 
 
 #include <algorithm>
+#include <memory>
 #include <confirm.h>
 
 #include <xnode.h>
@@ -32,6 +33,56 @@
 #include "netlist_exporter_kicad.h"
 
 
+/**
+ * Write the netlist records as S-expressions as they are received, producing the same output
+ * as XNODE::Format() would for the complete tree.
+ */
+class SEXPR_RECORD_WRITER : public NETLIST_RECORD_WRITER
+{
+public:
+    SEXPR_RECORD_WRITER( OUTPUTFORMATTER* aOut ) :
+            m_out( aOut ),
+            m_nestLevel( 0 )
+    {}
+
+    void StartSection( XNODE* aSection ) override
+    {
+        std::unique_ptr<XNODE> section( aSection );
+
+        startChild();
+        m_out->Print( m_nestLevel, "(%s", TO_UTF8( section->GetName() ) );
+        section->FormatContents( m_out, m_nestLevel );
+        m_nestLevel++;
+    }
+
+    void AddRecord( XNODE* aRecord ) override
+    {
+        std::unique_ptr<XNODE> record( aRecord );
+
+        startChild();
+        record->Format( m_out, m_nestLevel );
+    }
+
+    void EndSection() override
+    {
+        m_out->Print( 0, ")" );
+        m_nestLevel--;
+    }
+
+private:
+    void startChild()
+    {
+        // XNODE::Format() puts a newline before the first child of an element and after
+        // every child that has a following sibling.
+        if( m_nestLevel > 0 )
+            m_out->Print( 0, "\n" );
+    }
+
+    OUTPUTFORMATTER* m_out;
+    int              m_nestLevel;
+};
+
+
 bool NETLIST_EXPORTER_KICAD::WriteNetlist( const wxString& aOutFileName, unsigned aNetlistOptions,
                                            REPORTER& aReporter )
 {
@@ -53,7 +104,7 @@ bool NETLIST_EXPORTER_KICAD::WriteNetlist( const wxString& aOutFileName, unsigne
 
 void NETLIST_EXPORTER_KICAD::Format( OUTPUTFORMATTER* aOut, int aCtl )
 {
-    std::unique_ptr<XNODE> xroot( makeRoot( aCtl ) );
+    SEXPR_RECORD_WRITER writer( aOut );
 
-    xroot->Format( aOut, 0 );
+    writeRoot( writer, aCtl );
 }
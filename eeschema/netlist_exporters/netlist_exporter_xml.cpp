@@ -38,54 +38,217 @@
 #include <project_sch.h>
 
 #include <symbol_lib_table.h>
+#include <reporter.h>
 
+#include <memory>
 #include <set>
 
 static bool sortPinsByNumber( LIB_PIN* aPin1, LIB_PIN* aPin2 );
 
+/**
+ * Write the netlist records as XML as they are received, producing the same output as
+ * wxXmlDocument::Save() with an indent step of 2 would for the complete tree.
+ */
+class XML_RECORD_WRITER : public NETLIST_RECORD_WRITER
+{
+public:
+    XML_RECORD_WRITER( OUTPUTFORMATTER* aOut ) :
+            m_out( aOut )
+    {
+        m_out->Print( 0, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" );
+    }
+
+    void StartSection( XNODE* aSection ) override
+    {
+        std::unique_ptr<XNODE> section( aSection );
+
+        startChild();
+        startElement( section.get() );
+        m_sections.push_back( { section->GetName(), false } );
+    }
+
+    void AddRecord( XNODE* aRecord ) override
+    {
+        std::unique_ptr<XNODE> record( aRecord );
+
+        startChild();
+        formatNode( record.get(), indent() );
+    }
+
+    void EndSection() override
+    {
+        wxCHECK( !m_sections.empty(), /* void */ );
+
+        SECTION section = m_sections.back();
+        m_sections.pop_back();
+
+        if( section.m_HasChildren )
+        {
+            formatIndentation( indent() );
+            m_out->Print( 0, "</%s>", TO_UTF8( section.m_Name ) );
+        }
+        else
+        {
+            m_out->Print( 0, "/>" );
+        }
+
+        if( m_sections.empty() )
+            m_out->Print( 0, "\n" );
+    }
+
+private:
+    struct SECTION
+    {
+        wxString m_Name;
+        bool     m_HasChildren;
+    };
+
+    /// The indentation of the children of the current section
+    int indent() const { return 2 * (int) m_sections.size(); }
+
+    void startChild()
+    {
+        if( m_sections.empty() )
+            return;
+
+        if( !m_sections.back().m_HasChildren )
+        {
+            m_out->Print( 0, ">" );
+            m_sections.back().m_HasChildren = true;
+        }
+
+        formatIndentation( indent() );
+    }
+
+    void formatIndentation( int aIndent )
+    {
+        m_out->Print( 0, "\n%*s", aIndent, "" );
+    }
+
+    void formatEscaped( const wxString& aText, bool aAttribute )
+    {
+        wxString escaped;
+
+        escaped.reserve( aText.length() );
+
+        for( wxUniChar c : aText )
+        {
+            switch( c.GetValue() )
+            {
+            case '<':  escaped.append( wxS( "&lt;" ) );    break;
+            case '>':  escaped.append( wxS( "&gt;" ) );    break;
+            case '&':  escaped.append( wxS( "&amp;" ) );   break;
+            case '\r': escaped.append( wxS( "&#xD;" ) );   break;
+            case '"':  escaped.append( aAttribute ? wxS( "&quot;" ) : wxS( "\"" ) ); break;
+            case '\t': escaped.append( aAttribute ? wxS( "&#x9;" ) : wxS( "\t" ) );  break;
+            case '\n': escaped.append( aAttribute ? wxS( "&#xA;" ) : wxS( "\n" ) );  break;
+            default:   escaped += c;                        break;
+            }
+        }
+
+        m_out->Print( 0, "%s", TO_UTF8( escaped ) );
+    }
+
+    void startElement( XNODE* aNode )
+    {
+        m_out->Print( 0, "<%s", TO_UTF8( aNode->GetName() ) );
+
+        for( wxXmlAttribute* attr = aNode->GetAttributes(); attr; attr = attr->GetNext() )
+        {
+            m_out->Print( 0, " %s=\"", TO_UTF8( attr->GetName() ) );
+            formatEscaped( attr->GetValue(), true );
+            m_out->Print( 0, "\"" );
+        }
+    }
+
+    void formatNode( XNODE* aNode, int aIndent )
+    {
+        if( aNode->GetType() == wxXML_TEXT_NODE )
+        {
+            formatEscaped( aNode->GetContent(), false );
+            return;
+        }
+
+        startElement( aNode );
+
+        if( !aNode->GetChildren() )
+        {
+            m_out->Print( 0, "/>" );
+            return;
+        }
+
+        XNODE* prev = nullptr;
+
+        m_out->Print( 0, ">" );
+
+        for( XNODE* kid = aNode->GetChildren(); kid; kid = kid->GetNext() )
+        {
+            if( kid->GetType() != wxXML_TEXT_NODE )
+                formatIndentation( aIndent + 2 );
+
+            formatNode( kid, aIndent + 2 );
+            prev = kid;
+        }
+
+        if( prev->GetType() != wxXML_TEXT_NODE )
+            formatIndentation( aIndent );
+
+        m_out->Print( 0, "</%s>", TO_UTF8( aNode->GetName() ) );
+    }
+
+    OUTPUTFORMATTER*     m_out;
+    std::vector<SECTION> m_sections;
+};
+
+
 bool NETLIST_EXPORTER_XML::WriteNetlist( const wxString& aOutFileName, unsigned aNetlistOptions,
                                          REPORTER& aReporter )
 {
-    // output the XML format netlist.
-
-    // declare the stream ourselves to use the buffered FILE api
-    // instead of letting wx use the syscall variant
-    wxFFileOutputStream stream( aOutFileName );
+    // output the XML format netlist.  Records are written out as soon as they are built
+    // instead of assembling the whole document first, which gets expensive for large designs.
+    try
+    {
+        FILE_OUTPUTFORMATTER formatter( aOutFileName );
+        XML_RECORD_WRITER    writer( &formatter );
 
-    if( !stream.IsOk() )
+        writeRoot( writer, GNL_ALL | aNetlistOptions );
+    }
+    catch( const IO_ERROR& ioe )
+    {
+        aReporter.Report( ioe.What(), RPT_SEVERITY_ERROR );
         return false;
+    }
 
-    wxXmlDocument xdoc;
-    xdoc.SetRoot( makeRoot( GNL_ALL | aNetlistOptions ) );
-
-    return xdoc.Save( stream, 2 /* indent bug, today was ignored by wxXml lib */ );
+    return true;
 }
 
 
-XNODE* NETLIST_EXPORTER_XML::makeRoot( unsigned aCtl )
+void NETLIST_EXPORTER_XML::writeRoot( NETLIST_RECORD_WRITER& aWriter, unsigned aCtl )
 {
     XNODE*      xroot = node( wxT( "export" ) );
 
     xroot->AddAttribute( wxT( "version" ), wxT( "E" ) );
 
+    aWriter.StartSection( xroot );
+
     if( aCtl & GNL_HEADER )
         // add the "design" header
-        xroot->AddChild( makeDesignHeader() );
+        aWriter.AddRecord( makeDesignHeader() );
 
     if( aCtl & GNL_SYMBOLS )
-        xroot->AddChild( makeSymbols( aCtl ) );
+        writeSymbols( aWriter, aCtl );
 
     if( aCtl & GNL_PARTS )
-        xroot->AddChild( makeLibParts() );
+        writeLibParts( aWriter );
 
     if( aCtl & GNL_LIBRARIES )
-        // must follow makeGenericLibParts()
-        xroot->AddChild( makeLibraries() );
+        // must follow writeLibParts()
+        writeLibraries( aWriter );
 
     if( aCtl & GNL_NETS )
-        xroot->AddChild( makeListOfNets( aCtl ) );
+        writeListOfNets( aWriter, aCtl );
 
-    return xroot;
+    aWriter.EndSection();
 }
 
 
@@ -239,9 +402,9 @@ void NETLIST_EXPORTER_XML::addSymbolFields( XNODE* aNode, SCH_SYMBOL* aSymbol,
 }
 
 
-XNODE* NETLIST_EXPORTER_XML::makeSymbols( unsigned aCtl )
+void NETLIST_EXPORTER_XML::writeSymbols( NETLIST_RECORD_WRITER& aWriter, unsigned aCtl )
 {
-    XNODE* xcomps = node( wxT( "components" ) );
+    aWriter.StartSection( node( wxT( "components" ) ) );
 
     m_referencesAlreadyFound.Clear();
     m_libParts.clear();
@@ -304,8 +467,7 @@ XNODE* NETLIST_EXPORTER_XML::makeSymbols( unsigned aCtl )
             // not always look best, but it will allow faster execution under XSL processing
             // systems which do sequential searching within an element.
 
-            XNODE* xcomp;  // current symbol being constructed
-            xcomps->AddChild( xcomp = node( wxT( "comp" ) ) );
+            XNODE* xcomp = node( wxT( "comp" ) );  // current symbol being constructed
 
             xcomp->AddAttribute( wxT( "ref" ), symbol->GetRef( &sheet ) );
             addSymbolFields( xcomp, symbol, &sheet );
@@ -433,12 +595,14 @@ XNODE* NETLIST_EXPORTER_XML::makeSymbols( unsigned aCtl )
             // Output the primary UUID
             uuid = symbol->m_Uuid.AsString();
             xunits->AddChild( new XNODE( wxXML_TEXT_NODE, wxEmptyString, uuid ) );
+
+            aWriter.AddRecord( xcomp );
         }
     }
 
     m_schematic->SetCurrentSheet( currentSheet );
 
-    return xcomps;
+    aWriter.EndSection();
 }
 
 
@@ -543,11 +707,12 @@ XNODE* NETLIST_EXPORTER_XML::makeDesignHeader()
 }
 
 
-XNODE* NETLIST_EXPORTER_XML::makeLibraries()
+void NETLIST_EXPORTER_XML::writeLibraries( NETLIST_RECORD_WRITER& aWriter )
 {
-    XNODE*            xlibs = node( wxT( "libraries" ) );     // auto_ptr
     SYMBOL_LIB_TABLE* symbolLibTable = PROJECT_SCH::SchSymbolLibTable( &m_schematic->Prj() );
 
+    aWriter.StartSection( node( wxT( "libraries" ) ) );
+
     for( std::set<wxString>::iterator it = m_libraries.begin(); it!=m_libraries.end();  ++it )
     {
         wxString    libNickname = *it;
@@ -555,27 +720,29 @@ XNODE* NETLIST_EXPORTER_XML::makeLibraries()
 
         if( symbolLibTable->HasLibrary( libNickname ) )
         {
-            xlibs->AddChild( xlibrary = node( wxT( "library" ) ) );
+            xlibrary = node( wxT( "library" ) );
             xlibrary->AddAttribute( wxT( "logical" ), libNickname );
             xlibrary->AddChild( node( wxT( "uri" ), symbolLibTable->GetFullURI( libNickname ) ) );
+
+            aWriter.AddRecord( xlibrary );
         }
 
         // @todo: add more fun stuff here
     }
 
-    return xlibs;
+    aWriter.EndSection();
 }
 
 
-XNODE* NETLIST_EXPORTER_XML::makeLibParts()
+void NETLIST_EXPORTER_XML::writeLibParts( NETLIST_RECORD_WRITER& aWriter )
 {
-    XNODE*                  xlibparts = node( wxT( "libparts" ) );   // auto_ptr
-
     LIB_PINS                pinList;
     std::vector<LIB_FIELD*> fieldList;
 
     m_libraries.clear();
 
+    aWriter.StartSection( node( wxT( "libparts" ) ) );
+
     for( LIB_SYMBOL* lcomp : m_libParts )
     {
         wxString libNickname = lcomp->GetLibId().GetLibNickname();;
@@ -584,8 +751,7 @@ XNODE* NETLIST_EXPORTER_XML::makeLibParts()
         if( !libNickname.IsEmpty() )
             m_libraries.insert( libNickname );  // inserts symbol's library if unique
 
-        XNODE* xlibpart;
-        xlibparts->AddChild( xlibpart = node( wxT( "libpart" ) ) );
+        XNODE* xlibpart = node( wxT( "libpart" ) );
         xlibpart->AddAttribute( wxT( "lib" ), libNickname );
         xlibpart->AddAttribute( wxT( "part" ), lcomp->GetName()  );
 
@@ -659,15 +825,16 @@ XNODE* NETLIST_EXPORTER_XML::makeLibParts()
                 // caution: construction work site here, drive slowly
             }
         }
+
+        aWriter.AddRecord( xlibpart );
     }
 
-    return xlibparts;
+    aWriter.EndSection();
 }
 
 
-XNODE* NETLIST_EXPORTER_XML::makeListOfNets( unsigned aCtl )
+void NETLIST_EXPORTER_XML::writeListOfNets( NETLIST_RECORD_WRITER& aWriter, unsigned aCtl )
 {
-    XNODE*      xnets = node( wxT( "nets" ) );      // auto_ptr if exceptions ever get used.
     wxString    netCodeTxt;
     wxString    netName;
     wxString    ref;
@@ -747,12 +914,16 @@ XNODE* NETLIST_EXPORTER_XML::makeListOfNets( unsigned aCtl )
                    return StrNumCmp( a->m_Name, b->m_Name ) < 0;
                } );
 
+    aWriter.StartSection( node( wxT( "nets" ) ) );
+
     for( int i = 0; i < (int) nets.size(); ++i )
     {
         NET_RECORD* net_record = nets[i];
         bool        added = false;
         XNODE*      xnode;
 
+        xnet = nullptr;
+
         // Netlist ordering: Net name, then ref des, then pin name
         std::sort( net_record->m_Nodes.begin(), net_record->m_Nodes.end(),
         []( const NET_NODE& a, const NET_NODE& b )
@@ -808,7 +979,7 @@ XNODE* NETLIST_EXPORTER_XML::makeListOfNets( unsigned aCtl )
             {
                 netCodeTxt.Printf( wxT( "%d" ), i + 1 );
 
-                xnets->AddChild( xnet = node( wxT( "net" ) ) );
+                xnet = node( wxT( "net" ) );
                 xnet->AddAttribute( wxT( "code" ), netCodeTxt );
                 xnet->AddAttribute( wxT( "name" ), net_record->m_Name );
 
@@ -831,12 +1002,15 @@ XNODE* NETLIST_EXPORTER_XML::makeListOfNets( unsigned aCtl )
 
             xnode->AddAttribute( wxT( "pintype" ), pinType );
         }
+
+        if( xnet )
+            aWriter.AddRecord( xnet );
     }
 
+    aWriter.EndSection();
+
     for( NET_RECORD* record : nets )
         delete record;
-
-    return xnets;
 }
 
 
@@ -39,7 +39,7 @@ class XNODE;
 #define GENERIC_INTERMEDIATE_NETLIST_EXT wxT( "xml" )
 
 /**
- * A set of bits which control the totality of the tree built by makeRoot()
+ * A set of bits which control the totality of the tree written by writeRoot()
  */
 enum GNL_T
 {
@@ -53,6 +53,39 @@ enum GNL_T
 };
 
 
+/**
+ * Receive the netlist document one record at a time, so that the whole document tree never
+ * has to be held in memory.
+ *
+ * A section is opened with StartSection(), filled with records and nested sections and closed
+ * with EndSection().  Records are complete sub-trees (a component, a library part, a net...)
+ * which can be written out and discarded as soon as they are received.
+ */
+class NETLIST_RECORD_WRITER
+{
+public:
+    virtual ~NETLIST_RECORD_WRITER() {}
+
+    /**
+     * Open a new section inside the current one.
+     *
+     * @param aSection is the section element holding its name and attributes but no children.
+     *                 The writer takes ownership of it.
+     */
+    virtual void StartSection( XNODE* aSection ) = 0;
+
+    /**
+     * Add a complete record to the current section.  The writer takes ownership of it.
+     */
+    virtual void AddRecord( XNODE* aRecord ) = 0;
+
+    /**
+     * Close the current section.
+     */
+    virtual void EndSection() = 0;
+};
+
+
 /**
  * Generate a generic XML based netlist file.
  *
@@ -92,18 +125,19 @@ protected:
     XNODE* node( const wxString& aName, const wxString& aTextualContent = wxEmptyString );
 
     /**
-     * Build the entire document tree for the generic export.  This is factored
-     * out here so we can write the tree in either S-expression file format
-     * or in XML if we put the tree built here into a wxXmlDocument.
+     * Write the entire document for the generic export.  This is factored out here so we can
+     * write the document in either S-expression file format or in XML, depending on
+     * \a aWriter.  Records are handed to the writer as soon as they are built.
+     *
+     * @param aWriter is the destination of the document.
      * @param aCtl a bitset or-ed together from GNL_ENUM values
-     * @return the root nodes
      */
-    XNODE* makeRoot( unsigned aCtl = GNL_ALL );
+    void writeRoot( NETLIST_RECORD_WRITER& aWriter, unsigned aCtl = GNL_ALL );
 
     /**
-     * @return a sub-tree holding all the schematic symbols.
+     * Write the section holding all the schematic symbols.
      */
-    XNODE* makeSymbols( unsigned aCtl );
+    void writeSymbols( NETLIST_RECORD_WRITER& aWriter, unsigned aCtl );
 
     /**
      * Fill out a project "design" header into an XML node.
@@ -112,23 +146,20 @@ protected:
     XNODE* makeDesignHeader();
 
     /**
-     * Fill out an XML node with the unique library parts and returns it.
-     * @return the library parts nodes
+     * Write the section holding the unique library parts.
      */
-    XNODE* makeLibParts();
+    void writeLibParts( NETLIST_RECORD_WRITER& aWriter );
 
     /**
-     * Fill out an XML node with a list of nets and returns it.
-     * @return the list of nets nodes
+     * Write the section holding the list of nets.
      */
-    XNODE* makeListOfNets( unsigned aCtl );
+    void writeListOfNets( NETLIST_RECORD_WRITER& aWriter, unsigned aCtl );
 
     /**
-     * Fill out an XML node with a list of used libraries and returns it.
-     * Must have called makeGenericLibParts() before this function.
-     * @return the library nodes
+     * Write the section holding the list of used libraries.
+     * Must have called writeLibParts() before this function.
      */
-    XNODE* makeLibraries();
+    void writeLibraries( NETLIST_RECORD_WRITER& aWriter );
 
     void addSymbolFields( XNODE* aNode, SCH_SYMBOL* aSymbol, SCH_SHEET_PATH* aSheet );
 
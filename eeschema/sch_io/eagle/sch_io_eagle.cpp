@@ -800,7 +800,7 @@ void SCH_IO_EAGLE::loadSchematic( wxXmlNode* aSchematicNode )
 
         // N.B. Eagle parts are case-insensitive in matching but we keep the display case
         m_partlist[epart->name.Upper()] = std::move( epart );
-        partNode                        = partNode->GetNext();
+        partNode                        = ReleaseXmlNode( partNode );
     }
 
     if( libraryNode )
@@ -866,7 +866,7 @@ void SCH_IO_EAGLE::loadSchematic( wxXmlNode* aSchematicNode )
 
             currentScreen->Append( sheet.release() );
 
-            sheetNode = sheetNode->GetNext();
+            sheetNode = ReleaseXmlNode( sheetNode );
             x += 2;
 
             if( x > 10 ) // Start next row of sheets.
@@ -884,7 +884,7 @@ void SCH_IO_EAGLE::loadSchematic( wxXmlNode* aSchematicNode )
         while( sheetNode )
         {
             loadSheet( sheetNode, 0 );
-            sheetNode = sheetNode->GetNext();
+            sheetNode = ReleaseXmlNode( sheetNode );
         }
     }
 
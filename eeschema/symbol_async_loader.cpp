@@ -22,6 +22,7 @@
 
 #include <core/wx_stl_compat.h>
 #include <symbol_async_loader.h>
+#include <symbol_lib_index.h>
 #include <symbol_lib_table.h>
 #include <progress_reporter.h>
 
@@ -29,12 +30,14 @@
 SYMBOL_ASYNC_LOADER::SYMBOL_ASYNC_LOADER( const std::vector<wxString>& aNicknames,
         SYMBOL_LIB_TABLE* aTable, bool aOnlyPowerSymbols,
         std::unordered_map<wxString, std::vector<LIB_SYMBOL*>>* aOutput,
-        PROGRESS_REPORTER* aReporter ) :
+        PROGRESS_REPORTER* aReporter,
+        std::unordered_map<wxString, INDEXED_SYMBOLS>* aIndexOutput ) :
         m_nicknames( aNicknames ),
         m_table( aTable ),
         m_onlyPowerSymbols( aOnlyPowerSymbols ),
         m_output( aOutput ),
         m_reporter( aReporter ),
+        m_indexOutput( aIndexOutput ),
         m_nextLibrary( 0 )
 {
     wxASSERT( m_table );
@@ -111,10 +114,40 @@ std::vector<SYMBOL_ASYNC_LOADER::LOADED_PAIR> SYMBOL_ASYNC_LOADER::worker()
             break;
 
         LOADED_PAIR pair( nickname, {} );
+        wxString    indexPath;
+
+        if( m_indexOutput )
+        {
+            SYMBOL_LIB_TABLE_ROW* row = m_table->FindRow( nickname, true );
+
+            if( SYMBOL_LIB_INDEX::CanIndex( row ) )
+            {
+                INDEXED_SYMBOLS indexed;
+
+                indexPath = row->GetFullURI( true );
+
+                if( SYMBOL_LIB_INDEX::Read( indexPath, nickname, onlyPower, indexed ) )
+                {
+                    // Don't show libraries that had no power symbols
+                    if( !onlyPower || !indexed.empty() )
+                    {
+                        std::lock_guard<std::mutex> lock( m_indexMutex );
+                        ( *m_indexOutput )[nickname] = std::move( indexed );
+                    }
+
+                    continue;
+                }
+            }
+        }
 
         try
         {
             m_table->LoadSymbolLib( pair.second, nickname, onlyPower );
+
+            // A power symbols only load doesn't hold the whole library
+            if( !indexPath.IsEmpty() && !onlyPower )
+                SYMBOL_LIB_INDEX::Write( indexPath, pair.second );
+
             ret.emplace_back( std::move( pair ) );
         }
         catch( const IO_ERROR& ioe )
@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -31,12 +32,16 @@
 
 class LIB_SYMBOL;
 class PROGRESS_REPORTER;
+class SYMBOL_INDEX_ENTRY;
 class SYMBOL_LIB_TABLE;
 
 
 class SYMBOL_ASYNC_LOADER
 {
 public:
+    ///< The symbols of a library read from its index rather than from the library itself
+    typedef std::vector<std::unique_ptr<SYMBOL_INDEX_ENTRY>> INDEXED_SYMBOLS;
+
     /**
      * Constructs a loader for symbol libraries
      * @param aNicknames is a list of library nicknames to load
@@ -44,11 +49,14 @@ public:
      * @param aOnlyPowerSymbols, if true, will only return power symbols in the output map
      * @param aOutput will be filled with the loaded parts
      * @param aReporter will be used to repord progress, of not null
+     * @param aIndexOutput if not null, libraries with an up to date #SYMBOL_LIB_INDEX are not
+     *                     loaded; their indexed symbols are returned in this map instead
      */
     SYMBOL_ASYNC_LOADER( const std::vector<wxString>& aNicknames,
                          SYMBOL_LIB_TABLE* aTable, bool aOnlyPowerSymbols = false,
                          std::unordered_map<wxString, std::vector<LIB_SYMBOL*>>* aOutput = nullptr,
-                         PROGRESS_REPORTER* aReporter = nullptr );
+                         PROGRESS_REPORTER* aReporter = nullptr,
+                         std::unordered_map<wxString, INDEXED_SYMBOLS>* aIndexOutput = nullptr );
 
     ~SYMBOL_ASYNC_LOADER();
 
@@ -90,6 +98,10 @@ private:
     ///< Progress reporter (may be null)
     PROGRESS_REPORTER* m_reporter;
 
+    ///< Handle to map that will be filled with the indexed symbols per library (may be null)
+    std::unordered_map<wxString, INDEXED_SYMBOLS>* m_indexOutput;
+    std::mutex                                     m_indexMutex;
+
     size_t              m_threadCount;
     std::atomic<size_t> m_nextLibrary;
     wxString            m_errors;
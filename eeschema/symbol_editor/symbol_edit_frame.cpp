@@ -1606,11 +1606,11 @@ void SYMBOL_EDIT_FRAME::ClearUndoORRedoList( UNDO_REDO_LIST whichList, int aItem
     {
         for( int ii = 0; ii < aItemCount; ii++ )
         {
-            if( list.m_CommandsList.size() == 0 )
+            PICKED_ITEMS_LIST* curr_cmd = list.PopOldestCommand();
+
+            if( !curr_cmd )
                 break;
 
-            PICKED_ITEMS_LIST* curr_cmd = list.m_CommandsList[0];
-            list.m_CommandsList.erase( list.m_CommandsList.begin() );
 
             curr_cmd->ClearListAndDeleteItems( []( EDA_ITEM* aItem )
                                                {
@@ -0,0 +1,256 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+#include <wx/filename.h>
+#include <wx/intl.h>
+
+#include <cache_file.h>
+#include <lib_field.h>
+#include <lib_symbol.h>
+#include <symbol_lib_index.h>
+#include <symbol_lib_table.h>
+
+
+///< Bump this whenever the content of the index files changes
+static const int SYMBOL_LIB_INDEX_VERSION = 1;
+
+
+static std::string toUTF8( const wxString& aString )
+{
+    return std::string( aString.utf8_str() );
+}
+
+
+static wxString fromUTF8( const nlohmann::json& aJson )
+{
+    return wxString::FromUTF8( aJson.get<std::string>() );
+}
+
+
+wxString SYMBOL_INDEX_ENTRY::GetUnitReference( int aUnit )
+{
+    if( aUnit < 1 || aUnit > (int) m_units.size() )
+        return wxEmptyString;
+
+    return m_units[aUnit - 1].m_Reference;
+}
+
+
+bool SYMBOL_INDEX_ENTRY::HasUnitDisplayName( int aUnit )
+{
+    if( aUnit < 1 || aUnit > (int) m_units.size() )
+        return false;
+
+    return !m_units[aUnit - 1].m_DisplayName.IsEmpty();
+}
+
+
+wxString SYMBOL_INDEX_ENTRY::GetUnitDisplayName( int aUnit )
+{
+    if( HasUnitDisplayName( aUnit ) )
+        return m_units[aUnit - 1].m_DisplayName;
+
+    return wxString::Format( _( "Unit %s" ), GetUnitReference( aUnit ) );
+}
+
+
+bool SYMBOL_LIB_INDEX::CanIndex( const SYMBOL_LIB_TABLE_ROW* aRow )
+{
+    if( !aRow || aRow->SchLibType() != SCH_IO_MGR::SCH_KICAD )
+        return false;
+
+    return wxFileName::FileExists( aRow->GetFullURI( true ) );
+}
+
+
+wxString SYMBOL_LIB_INDEX::indexFileName( const wxString& aLibPath )
+{
+    // The full library path is stored in the index and checked when reading it back
+    return CACHE_FILE::GetPath( wxT( "symbol_index" ), aLibPath, wxT( "json" ) );
+}
+
+
+bool SYMBOL_LIB_INDEX::libraryStamp( const wxString& aLibPath, long long& aSize,
+                                     long long& aModTime )
+{
+    wxFileName fn( aLibPath );
+
+    if( !fn.FileExists() )
+        return false;
+
+    aSize = fn.GetSize().GetValue();
+    aModTime = fn.GetModificationTime().GetValue().GetValue();
+    return true;
+}
+
+
+bool SYMBOL_LIB_INDEX::Read( const wxString& aLibPath, const wxString& aNickname,
+                             bool aOnlyPowerSymbols,
+                             std::vector<std::unique_ptr<SYMBOL_INDEX_ENTRY>>& aEntries )
+{
+    long long size = 0;
+    long long modTime = 0;
+
+    aEntries.clear();
+
+    if( !libraryStamp( aLibPath, size, modTime ) )
+        return false;
+
+    std::ifstream stream( indexFileName( aLibPath ).fn_str() );
+
+    if( !stream.is_open() )
+        return false;
+
+    try
+    {
+        nlohmann::json index;
+
+        stream >> index;
+
+        if( index.at( "version" ).get<int>() != SYMBOL_LIB_INDEX_VERSION
+                || fromUTF8( index.at( "path" ) ) != aLibPath
+                || index.at( "size" ).get<long long>() != size
+                || index.at( "mtime" ).get<long long>() != modTime )
+        {
+            return false;
+        }
+
+        for( const nlohmann::json& symbol : index.at( "symbols" ) )
+        {
+            if( aOnlyPowerSymbols && !symbol.at( "power" ).get<bool>() )
+                continue;
+
+            auto entry = std::make_unique<SYMBOL_INDEX_ENTRY>();
+
+            entry->m_libId = LIB_ID( aNickname, fromUTF8( symbol.at( "name" ) ) );
+            entry->m_description = fromUTF8( symbol.at( "description" ) );
+            entry->m_footprint = fromUTF8( symbol.at( "footprint" ) );
+            entry->m_isRoot = symbol.at( "root" ).get<bool>();
+            entry->m_isPower = symbol.at( "power" ).get<bool>();
+            entry->m_pinCount = symbol.at( "pins" ).get<int>();
+
+            for( const nlohmann::json& unit : symbol.at( "units" ) )
+            {
+                entry->m_units.push_back( { fromUTF8( unit.at( "ref" ) ),
+                                            fromUTF8( unit.at( "name" ) ) } );
+            }
+
+            const nlohmann::json& fields = symbol.at( "fields" );
+
+            for( auto it = fields.begin(); it != fields.end(); ++it )
+                entry->m_chooserFields[ wxString::FromUTF8( it.key() ) ] = fromUTF8( it.value() );
+
+            for( const nlohmann::json& fieldName : symbol.at( "field_names" ) )
+                entry->m_fieldNames.push_back( fromUTF8( fieldName ) );
+
+            for( const nlohmann::json& term : symbol.at( "terms" ) )
+            {
+                entry->m_searchTerms.emplace_back( fromUTF8( term.at( 0 ) ),
+                                                   term.at( 1 ).get<int>() );
+            }
+
+            aEntries.push_back( std::move( entry ) );
+        }
+    }
+    catch( ... )
+    {
+        // whatever went wrong, the library will just be loaded the slow way
+        aEntries.clear();
+        return false;
+    }
+
+    return true;
+}
+
+
+void SYMBOL_LIB_INDEX::Write( const wxString& aLibPath, const std::vector<LIB_SYMBOL*>& aSymbols )
+{
+    long long size = 0;
+    long long modTime = 0;
+
+    if( !libraryStamp( aLibPath, size, modTime ) )
+        return;
+
+    nlohmann::json index;
+    nlohmann::json symbols = nlohmann::json::array();
+
+    index["version"] = SYMBOL_LIB_INDEX_VERSION;
+    index["path"] = toUTF8( aLibPath );
+    index["size"] = size;
+    index["mtime"] = modTime;
+
+    for( LIB_SYMBOL* symbol : aSymbols )
+    {
+        nlohmann::json entry;
+        nlohmann::json units = nlohmann::json::array();
+        nlohmann::json fields = nlohmann::json::object();
+        nlohmann::json fieldNames = nlohmann::json::array();
+        nlohmann::json terms = nlohmann::json::array();
+
+        entry["name"] = toUTF8( symbol->GetName() );
+        entry["description"] = toUTF8( symbol->GetDescription() );
+        entry["footprint"] = toUTF8( symbol->GetFootprint() );
+        entry["root"] = symbol->IsRoot();
+        entry["power"] = symbol->IsPower();
+        entry["pins"] = symbol->GetPinCount();
+
+        for( int unit = 1; unit <= symbol->GetUnitCount(); ++unit )
+        {
+            wxString displayName;
+
+            if( symbol->HasUnitDisplayName( unit ) )
+                displayName = symbol->GetUnitDisplayName( unit );
+
+            units.push_back( { { "ref", toUTF8( symbol->GetUnitReference( unit ) ) },
+                               { "name", toUTF8( displayName ) } } );
+        }
+
+        std::map<wxString, wxString> chooserFields;
+        symbol->GetChooserFields( chooserFields );
+
+        for( const auto& [ name, text ] : chooserFields )
+            fields[ toUTF8( name ) ] = toUTF8( text );
+
+        std::vector<LIB_FIELD*> libFields;
+        symbol->GetFields( libFields );
+
+        for( LIB_FIELD* field : libFields )
+        {
+            if( !field->IsMandatory() )
+                fieldNames.push_back( toUTF8( field->GetName() ) );
+        }
+
+        for( const SEARCH_TERM& term : symbol->GetSearchTerms() )
+            terms.push_back( { toUTF8( term.Text ), term.Score } );
+
+        entry["units"] = units;
+        entry["fields"] = fields;
+        entry["field_names"] = fieldNames;
+        entry["terms"] = terms;
+
+        symbols.push_back( entry );
+    }
+
+    index["symbols"] = symbols;
+
+    CACHE_FILE::Write( indexFileName( aLibPath ), index.dump() );
+}
@@ -0,0 +1,149 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYMBOL_LIB_INDEX_H
+#define SYMBOL_LIB_INDEX_H
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <lib_id.h>
+#include <lib_tree_item.h>
+
+class LIB_SYMBOL;
+class SYMBOL_LIB_TABLE_ROW;
+
+
+/**
+ * The symbol chooser metadata of a library symbol, as read back from a #SYMBOL_LIB_INDEX.
+ *
+ * It holds everything needed to populate the library tree without parsing the symbol.  The
+ * full #LIB_SYMBOL is only loaded from the library once it is previewed or placed.
+ */
+class SYMBOL_INDEX_ENTRY : public LIB_TREE_ITEM
+{
+public:
+    SYMBOL_INDEX_ENTRY() :
+            m_isRoot( true ),
+            m_isPower( false ),
+            m_pinCount( 0 )
+    {}
+
+    LIB_ID GetLibId() const override { return m_libId; }
+
+    wxString GetName() const override { return m_libId.GetUniStringLibItemName(); }
+    wxString GetLibNickname() const override { return m_libId.GetUniStringLibNickname(); }
+    wxString GetDescription() override { return m_description; }
+
+    void GetChooserFields( std::map<wxString, wxString>& aColumnMap ) override
+    {
+        for( const auto& [ name, text ] : m_chooserFields )
+            aColumnMap[name] = text;
+    }
+
+    std::vector<SEARCH_TERM> GetSearchTerms() override { return m_searchTerms; }
+
+    bool IsRoot() const override { return m_isRoot; }
+
+    bool IsPower() const { return m_isPower; }
+
+    wxString GetFootprint() override { return m_footprint; }
+
+    int GetPinCount() override { return m_pinCount; }
+
+    int GetUnitCount() const override { return (int) m_units.size(); }
+
+    wxString GetUnitReference( int aUnit ) override;
+
+    wxString GetUnitDisplayName( int aUnit ) override;
+
+    bool HasUnitDisplayName( int aUnit ) override;
+
+    /**
+     * @return the names of the non-mandatory fields of the symbol.
+     */
+    const std::vector<wxString>& GetFieldNames() const { return m_fieldNames; }
+
+private:
+    friend class SYMBOL_LIB_INDEX;
+
+    struct UNIT
+    {
+        wxString m_Reference;
+        wxString m_DisplayName;     ///< Empty if the unit has no display name
+    };
+
+    LIB_ID                       m_libId;
+    wxString                     m_description;
+    wxString                     m_footprint;
+    bool                         m_isRoot;
+    bool                         m_isPower;
+    int                          m_pinCount;
+    std::vector<UNIT>            m_units;
+    std::map<wxString, wxString> m_chooserFields;
+    std::vector<wxString>        m_fieldNames;
+    std::vector<SEARCH_TERM>     m_searchTerms;
+};
+
+
+/**
+ * A persistent, per-library index of the symbol chooser metadata.
+ *
+ * Indexes are stored in the user cache directory, one file per library.  They are keyed by the
+ * library file path, size and modification time, so an index is ignored as soon as its library
+ * changes on disk.  Only single file KiCad symbol libraries are indexed.
+ */
+class SYMBOL_LIB_INDEX
+{
+public:
+    /**
+     * @return true if the library of \a aRow can be indexed.
+     */
+    static bool CanIndex( const SYMBOL_LIB_TABLE_ROW* aRow );
+
+    /**
+     * Read the index of a library.
+     *
+     * @param aLibPath is the full path of the library file.
+     * @param aNickname is the library nickname given to the entries.
+     * @param aOnlyPowerSymbols if true, only the power symbols are returned.
+     * @param aEntries is filled with the indexed symbols.
+     * @return true if an up to date index was found.
+     */
+    static bool Read( const wxString& aLibPath, const wxString& aNickname, bool aOnlyPowerSymbols,
+                      std::vector<std::unique_ptr<SYMBOL_INDEX_ENTRY>>& aEntries );
+
+    /**
+     * Write the index of a library from its fully loaded list of symbols.
+     *
+     * Failing to write the index is not an error: it is only a cache.
+     *
+     * @param aLibPath is the full path of the library file.
+     * @param aSymbols is the complete list of symbols of the library.
+     */
+    static void Write( const wxString& aLibPath, const std::vector<LIB_SYMBOL*>& aSymbols );
+
+private:
+    static wxString indexFileName( const wxString& aLibPath );
+
+    static bool libraryStamp( const wxString& aLibPath, long long& aSize, long long& aModTime );
+};
+
+#endif
@@ -33,6 +33,7 @@
 #include <locale_io.h>
 #include <lib_symbol.h>
 #include <symbol_async_loader.h>
+#include <symbol_lib_index.h>
 #include <symbol_lib_table.h>
 #include <symbol_tree_model_adapter.h>
 #include <string_utils.h>
@@ -80,8 +81,12 @@ bool SYMBOL_TREE_MODEL_ADAPTER::AddLibraries( const std::vector<wxString>& aNick
 
     std::unordered_map<wxString, std::vector<LIB_SYMBOL*>> loadedSymbolMap;
 
+    // Libraries with an up to date index don't need to be parsed to populate the tree; their
+    // symbols are only loaded once previewed or placed.
+    std::unordered_map<wxString, SYMBOL_ASYNC_LOADER::INDEXED_SYMBOLS> indexedSymbolMap;
+
     SYMBOL_ASYNC_LOADER loader( aNicknames, m_libs, GetFilter() != nullptr, &loadedSymbolMap,
-                                progressReporter.get() );
+                                progressReporter.get(), &indexedSymbolMap );
 
     LOCALE_IO toggle;
 
@@ -115,23 +120,35 @@ bool SYMBOL_TREE_MODEL_ADAPTER::AddLibraries( const std::vector<wxString>& aNick
         dlg.ShowModal();
     }
 
-    if( loadedSymbolMap.size() > 0 )
+    std::unordered_map<wxString, std::vector<LIB_TREE_ITEM*>> treeItemMap;
+
+    for( const auto& [libNickname, libSymbols] : loadedSymbolMap )
+        treeItemMap[libNickname].assign( libSymbols.begin(), libSymbols.end() );
+
+    for( const auto& [libNickname, libSymbols] : indexedSymbolMap )
+    {
+        std::vector<LIB_TREE_ITEM*>& treeItems = treeItemMap[libNickname];
+
+        for( const std::unique_ptr<SYMBOL_INDEX_ENTRY>& entry : libSymbols )
+            treeItems.push_back( entry.get() );
+    }
+
+    if( treeItemMap.size() > 0 )
     {
         COMMON_SETTINGS* cfg = Pgm().GetCommonSettings();
         PROJECT_FILE&    project = aFrame->Prj().GetProjectFile();
 
         auto addFunc =
-                [&]( const wxString& aLibName, const std::vector<LIB_SYMBOL*>& aSymbolList,
+                [&]( const wxString& aLibName, const std::vector<LIB_TREE_ITEM*>& aTreeItems,
                      const wxString& aDescription )
                 {
-                    std::vector<LIB_TREE_ITEM*> treeItems( aSymbolList.begin(), aSymbolList.end() );
                     bool pinned = alg::contains( cfg->m_Session.pinned_symbol_libs, aLibName )
                                   || alg::contains( project.m_PinnedSymbolLibs, aLibName );
 
-                    DoAddLibrary( aLibName, aDescription, treeItems, pinned, false );
+                    DoAddLibrary( aLibName, aDescription, aTreeItems, pinned, false );
                 };
 
-        for( const auto& [libNickname, libSymbols] : loadedSymbolMap )
+        for( const auto& [libNickname, libSymbols] : treeItemMap )
         {
             SYMBOL_LIB_TABLE_ROW* row = m_libs->FindRow( libNickname );
 
@@ -143,6 +160,20 @@ bool SYMBOL_TREE_MODEL_ADAPTER::AddLibraries( const std::vector<wxString>& aNick
             std::vector<wxString> additionalColumns;
             row->GetAvailableSymbolFields( additionalColumns );
 
+            // Indexed libraries are not loaded, so their fields come from the index
+            if( indexedSymbolMap.count( libNickname ) )
+            {
+                for( const std::unique_ptr<SYMBOL_INDEX_ENTRY>& entry :
+                        indexedSymbolMap.at( libNickname ) )
+                {
+                    for( const wxString& fieldName : entry->GetFieldNames() )
+                    {
+                        if( !alg::contains( additionalColumns, fieldName ) )
+                            additionalColumns.push_back( fieldName );
+                    }
+                }
+            }
+
             for( const wxString& column : additionalColumns )
                 addColumnIfNecessary( column );
 
@@ -165,11 +196,11 @@ bool SYMBOL_TREE_MODEL_ADAPTER::AddLibraries( const std::vector<wxString>& aNick
 
                     UTF8 utf8Lib( lib );
 
-                    std::vector<LIB_SYMBOL*> symbols;
+                    std::vector<LIB_TREE_ITEM*> symbols;
 
                     std::copy_if( libSymbols.begin(), libSymbols.end(),
                                   std::back_inserter( symbols ),
-                                  [&utf8Lib]( LIB_SYMBOL* aSym )
+                                  [&utf8Lib]( LIB_TREE_ITEM* aSym )
                                   {
                                       return utf8Lib == aSym->GetLibId().GetSubLibraryName();
                                   } );
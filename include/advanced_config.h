@@ -509,6 +509,17 @@ public:
      */
     int m_MinimumSegmentLength;
 
+    /**
+     * Approximate memory the undo and redo histories of an editor may each use, in MB.  The
+     * oldest commands are dropped (in addition to the command count limit) beyond it; the
+     * last command is always kept.  0 disables the limit.
+     *
+     * Setting name: "MaxUndoMemory"
+     * Valid values: 0 to 65536
+     * Default value: 2048
+     */
+    int m_MaxUndoMemory;
+
 ///@}
 
 
@@ -0,0 +1,60 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CACHE_FILE_H
+#define CACHE_FILE_H
+
+#include <string>
+
+#include <kicommon.h>
+#include <wx/string.h>
+
+/**
+ * Helpers for the files KiCad keeps to speed up later sessions, such as library indexes.
+ *
+ * These files are only caches: failing to write one is never an error, and a reader must
+ * check that a file matches what it expects before using it.
+ */
+namespace CACHE_FILE
+{
+
+/**
+ * Return the path of the cache file for \a aKey in the \a aSubdir folder of the user cache
+ * directory.
+ *
+ * The file name is a hash of \a aKey, so \a aKey has to be stored in the file and checked when
+ * reading it back.
+ */
+KICOMMON_API wxString GetPath( const wxString& aSubdir, const wxString& aKey,
+                               const wxString& aExtension );
+
+/**
+ * Replace the content of the file \a aPath with \a aContent.
+ *
+ * The content is written to a temporary file which is then renamed over \a aPath, so a
+ * concurrent reader never sees a partial file.  The permissions of an existing file are kept,
+ * and the folder of \a aPath is created if needed.
+ *
+ * @return true if the file was written.
+ */
+KICOMMON_API bool Write( const wxString& aPath, const std::string& aContent );
+
+} // namespace CACHE_FILE
+
+#endif // CACHE_FILE_H
@@ -584,6 +584,16 @@ public:
 
     int GetMaxUndoItems() const { return m_undoRedoCountMax; }
 
+    /**
+     * Estimate the memory used by the item copies held by an undo or redo command.
+     *
+     * Used to keep the undo and redo histories within ADVANCED_CFG::m_MaxUndoMemory.  Frames
+     * which do not override it only have the command count limit.
+     *
+     * @return the approximate size in bytes.
+     */
+    virtual size_t GetUndoCommandMemory( const PICKED_ITEMS_LIST* aCommand ) const { return 0; }
+
     /**
      * Must be called after a model change in order to set the "modify" flag and do other
      * frame-specific processing.
@@ -672,6 +682,13 @@ protected:
 
     void ensureWindowIsOnScreen();
 
+    /**
+     * Delete the oldest commands of \a aList while its item copies use more memory than
+     * ADVANCED_CFG::m_MaxUndoMemory, as estimated by GetUndoCommandMemory() when each command
+     * was pushed.
+     */
+    void trimUndoRedoMemory( UNDO_REDO_LIST aList );
+
     /**
      * Saves any design-related project settings associated with this frame.
      * This method should only be called as the result of direct user action, for example from an
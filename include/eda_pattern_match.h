@@ -178,6 +178,8 @@ public:
 class KICOMMON_API EDA_PATTERN_MATCH_RELATIONAL : public EDA_PATTERN_MATCH
 {
 public:
+    EDA_PATTERN_MATCH_RELATIONAL();
+
     virtual bool SetPattern( const wxString& aPattern ) override;
     virtual wxString const& GetPattern() const override;
     virtual FIND_RESULT     Find( const wxString& aCandidate ) const override;
@@ -192,8 +194,11 @@ protected:
     RELATION m_relation;
     double   m_value;
 
-    static wxRegEx m_regex_description;
-    static wxRegEx m_regex_search;
+    // Not shared between instances: a wxRegEx holds the state of its last match, and matchers
+    // may run on several threads at once
+    wxRegEx m_regex_description;
+    wxRegEx m_regex_search;
+
     static const std::map<wxString, double> m_units;
 };
 
@@ -242,6 +247,12 @@ public:
 
     const wxString& GetPattern() const;
 
+    /**
+     * @return true if the pattern matches exactly the terms which contain it, i.e. none of
+     *         the matchers gives it a regex, wildcard or relational meaning.
+     */
+    bool IsSubstringPattern() const;
+
     int ScoreTerms( std::vector<SEARCH_TERM>& aWeightedTerms );
 
 private:
@@ -32,6 +32,7 @@
 class FOOTPRINT;
 class FP_LIB_TABLE_GRID;
 class PCB_IO;
+struct FOOTPRINT_METADATA;
 
 
 /**
@@ -194,6 +195,17 @@ public:
      */
     const FOOTPRINT* GetEnumeratedFootprint( const wxString& aNickname,
                                              const wxString& aFootprintName );
+
+    /**
+     * Fetch the chooser metadata of a footprint after #FootprintEnumerate(), without
+     * necessarily loading the footprint itself.
+     *
+     * @return false if the footprint cannot be found or read.
+     */
+    bool GetEnumeratedFootprintMetadata( const wxString& aNickname,
+                                         const wxString& aFootprintName,
+                                         FOOTPRINT_METADATA& aMetadata );
+
     /**
      * The set of return values from FootprintSave() below.
      */
@@ -130,6 +130,19 @@ private:
 };
 
 
+#ifndef SWIG
+namespace std
+{
+    // Required to use KIID as the key of unordered maps and sets
+    template <>
+    struct hash<KIID>
+    {
+        size_t operator()( const KIID& aId ) const { return aId.Hash(); }
+    };
+}
+#endif
+
+
 extern KICOMMON_API KIID niluuid;
 
 KICOMMON_API KIID& NilUuid();
@@ -23,9 +23,11 @@
 #ifndef LIB_TREE_MODEL_H
 #define LIB_TREE_MODEL_H
 
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <wx/string.h>
 #include <eda_pattern_match.h>
 #include <lib_tree_item.h>
@@ -216,6 +218,15 @@ public:
     void UpdateScore( EDA_COMBINED_MATCHER* aMatcher, const wxString& aLib,
                       std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) override;
 
+    /**
+     * Perform the search, knowing whether the search terms may match \a aMatcher at all.
+     *
+     * @param aMayMatch false if a #LIB_TREE_SEARCH_INDEX has ruled this item out, in which
+     *                  case its search terms are not scored.
+     */
+    void UpdateScore( EDA_COMBINED_MATCHER* aMatcher, const wxString& aLib,
+                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter, bool aMayMatch );
+
 protected:
     /**
      * Add a new unit to the component and return it.
@@ -226,6 +237,41 @@ protected:
 };
 
 
+/**
+ * A trigram index of the search terms of a list of nodes.
+ *
+ * A term can only contain a pattern if it contains every trigram of the pattern, so the index
+ * gives a small superset of the nodes matching a substring pattern without scoring every node.
+ */
+class LIB_TREE_SEARCH_INDEX
+{
+public:
+    /**
+     * @return true if the index was built for exactly the nodes of \a aNodes.
+     */
+    bool IsValidFor( const LIB_TREE_NODE::PTR_VECTOR& aNodes ) const;
+
+    /**
+     * Index the search terms of \a aNodes, normalizing them as the matchers do.
+     */
+    void Build( LIB_TREE_NODE::PTR_VECTOR& aNodes );
+
+    void Clear();
+
+    /**
+     * Find the nodes whose search terms may contain \a aPattern.
+     *
+     * @param aCandidates is filled with a flag per indexed node.  It is left empty if the
+     *                    pattern is too short to use the index.
+     */
+    void FindCandidates( const wxString& aPattern, std::vector<bool>& aCandidates ) const;
+
+private:
+    std::vector<const LIB_TREE_NODE*>              m_nodes;
+    std::unordered_map<uint64_t, std::vector<int>> m_trigrams;   ///< Sorted node indices
+};
+
+
 /**
  * Node type: library
  */
@@ -257,6 +303,15 @@ public:
 
     void UpdateScore( EDA_COMBINED_MATCHER* aMatcher, const wxString& aLib,
                       std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) override;
+
+    /**
+     * Discard the search index, e.g. because the search terms of an item have changed.
+     * Added and removed items are detected without this.
+     */
+    void InvalidateSearchIndex() { m_searchIndex.Clear(); }
+
+private:
+    LIB_TREE_SEARCH_INDEX m_searchIndex;
 };
 
 
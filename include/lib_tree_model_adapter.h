@@ -400,6 +400,14 @@ private:
      */
     const LIB_TREE_NODE* ShowResults();
 
+    /**
+     * Accumulate the scores of one search term over the whole tree.
+     *
+     * Unfiltered passes are spread over the thread pool, one block of libraries per task.
+     */
+    void scoreTree( const wxString& aPattern, const wxString& aLib,
+                    std::function<bool( LIB_TREE_NODE& aNode )>* aFilter );
+
     wxDataViewColumn* doAddColumn( const wxString& aHeader, bool aTranslate = true );
 
 protected:
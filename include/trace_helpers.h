@@ -135,6 +135,13 @@ extern KICOMMON_API const wxChar* const traceKicadPcbPlugin;
  */
 extern KICOMMON_API const wxChar* const traceGedaPcbPlugin;
 
+/**
+ * Flag to enable Altium PCB importer debug output, such as the time spent on each stream.
+ *
+ * Use "KICAD_ALTIUM_PCB_PLUGIN" to enable.
+ */
+extern KICOMMON_API const wxChar* const traceAltiumPcbPlugin;
+
 /**
  * Flag to enable print controller debug output.
  *
@@ -29,6 +29,7 @@
 #include <core/typeinfo.h>
 #include <eda_item_flags.h>
 #include <functional>
+#include <unordered_map>
 #include <vector>
 #include <wx/string.h>
 
@@ -310,13 +311,39 @@ public:
     UNDO_REDO_CONTAINER();
     ~UNDO_REDO_CONTAINER();
 
-    void PushCommand( PICKED_ITEMS_LIST* aCommand );
+    /**
+     * Add \a aCommand as the newest command.
+     *
+     * @param aMemory is the estimated size of the item copies held by \a aCommand.
+     */
+    void PushCommand( PICKED_ITEMS_LIST* aCommand, size_t aMemory = 0 );
 
     PICKED_ITEMS_LIST* PopCommand();
 
+    /**
+     * Remove the oldest command from the list and return it, or nullptr if the list is empty.
+     */
+    PICKED_ITEMS_LIST* PopOldestCommand();
+
     void ClearCommandList();
 
+    /**
+     * @return the memory estimate given when \a aCommand was pushed.
+     */
+    size_t GetCommandMemory( const PICKED_ITEMS_LIST* aCommand ) const;
+
+    /**
+     * @return the sum of the memory estimates of all the commands in the list.
+     */
+    size_t GetMemory() const { return m_memory; }
+
     std::vector <PICKED_ITEMS_LIST*> m_CommandsList;   // the list of possible undo/redo commands
+
+private:
+    void forgetCommand( const PICKED_ITEMS_LIST* aCommand );
+
+    std::unordered_map<const PICKED_ITEMS_LIST*, size_t> m_commandMemory;
+    size_t                                               m_memory = 0;
 };
 
 
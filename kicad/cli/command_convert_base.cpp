@@ -0,0 +1,281 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command_convert_base.h"
+#include <cli/exit_codes.h>
+#include <string_utils.h>
+#include <wx/apptrait.h>
+#include <wx/crt.h>
+#include <wx/dir.h>
+#include <wx/evtloop.h>
+#include <wx/filename.h>
+#include <wx/process.h>
+#include <wx/stdpaths.h>
+#include <wx/utils.h>
+
+#include <macros.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <thread>
+
+#define ARG_FORMAT "--format"
+
+
+namespace
+{
+
+/**
+ * A child kicad-cli process converting one input file.
+ */
+class CONVERT_PROCESS : public wxProcess
+{
+public:
+    CONVERT_PROCESS( size_t aIndex ) :
+            wxProcess( wxPROCESS_REDIRECT ),
+            m_index( aIndex ),
+            m_finished( false ),
+            m_exitCode( -1 )
+    {}
+
+    void OnTerminate( int aPid, int aStatus ) override
+    {
+        m_exitCode = aStatus;
+        m_finished = true;
+    }
+
+    /**
+     * Read what the child wrote so far.  The pipes have to be emptied while it runs, or it
+     * blocks once they are full.  Only the error output is kept.
+     */
+    void ReadOutput()
+    {
+        std::string discarded;
+
+        readStream( GetInputStream(), discarded );
+        readStream( GetErrorStream(), m_errors );
+    }
+
+    size_t   GetIndex() const { return m_index; }
+    bool     IsFinished() const { return m_finished; }
+    int      GetExitCode() const { return m_exitCode; }
+    wxString GetErrors() const { return wxString::FromUTF8( m_errors ); }
+
+private:
+    static void readStream( wxInputStream* aStream, std::string& aText )
+    {
+        char buffer[4096];
+
+        while( aStream && aStream->CanRead() )
+        {
+            size_t count = aStream->Read( buffer, sizeof( buffer ) ).LastRead();
+
+            if( count == 0 )
+                break;
+
+            aText.append( buffer, count );
+        }
+    }
+
+    size_t      m_index;
+    bool        m_finished;
+    int         m_exitCode;
+    std::string m_errors;
+};
+
+} // namespace
+
+
+CLI::CONVERT_BASE_COMMAND::CONVERT_BASE_COMMAND( const std::string& aParentName ) :
+        COMMAND( "convert" ),
+        m_parentName( aParentName )
+{
+    addCommonArgs( false, true, false, true );
+
+    m_argParser.add_argument( ARG_FORMAT )
+            .default_value( std::string() )
+            .help( UTF8STDSTR( _( "Name of the importer to read the input files with, e.g. "
+                                  "'EAGLE'; guessed from each file when omitted" ) ) )
+            .metavar( "IMPORTER" );
+
+    m_argParser.add_argument( ARG_INPUT )
+            .help( UTF8STDSTR( _( "Input files, several files are converted in parallel" ) ) )
+            .metavar( "INPUT_FILE" )
+            .nargs( argparse::nargs_pattern::at_least_one );
+}
+
+
+int CLI::CONVERT_BASE_COMMAND::doPerform( KIWAY& aKiway )
+{
+    wxString format = From_UTF8( m_argParser.get<std::string>( ARG_FORMAT ).c_str() );
+
+    wxFileName outputDir;
+
+    if( !m_argOutput.IsEmpty() )
+    {
+        outputDir.AssignDir( m_argOutput );
+        outputDir.MakeAbsolute();
+
+        if( !outputDir.DirExists() && !outputDir.Mkdir( wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL ) )
+        {
+            wxFprintf( stderr, _( "Unable to create output directory '%s'\n" ),
+                       outputDir.GetPath() );
+            return EXIT_CODES::ERR_INVALID_OUTPUT_CONFLICT;
+        }
+    }
+
+    std::vector<std::string> args = m_argParser.get<std::vector<std::string>>( ARG_INPUT );
+    std::vector<wxString>    inputs;
+    std::vector<wxString>    outputs;
+    std::set<wxString>       usedOutputs;
+
+    for( const std::string& arg : args )
+    {
+        wxFileName input( From_UTF8( arg.c_str() ) );
+        input.MakeAbsolute();
+
+        if( !input.FileExists() )
+        {
+            wxFprintf( stderr, _( "Input file '%s' does not exist or is not accessible\n" ),
+                       input.GetFullPath() );
+            return EXIT_CODES::ERR_INVALID_INPUT_FILE;
+        }
+
+        wxFileName output = input;
+        output.SetExt( outputExtension() );
+
+        if( outputDir.IsOk() )
+            output.SetPath( outputDir.GetPath() );
+
+        // The extra files of designs converted side by side could overwrite each other
+        if( args.size() > 1 && hasExtraOutputFiles() )
+            output.AppendDir( input.GetName() );
+
+        if( output == input || !usedOutputs.insert( output.GetFullPath() ).second )
+        {
+            wxFprintf( stderr, _( "Converting '%s' would overwrite '%s'\n" ),
+                       input.GetFullPath(), output.GetFullPath() );
+            return EXIT_CODES::ERR_INVALID_OUTPUT_CONFLICT;
+        }
+
+        inputs.push_back( input.GetFullPath() );
+        outputs.push_back( output.GetFullPath() );
+    }
+
+    if( inputs.size() == 1 )
+        return convertFile( aKiway, inputs[0], outputs[0], format );
+
+    return convertInChildProcesses( inputs, outputs, format );
+}
+
+
+int CLI::CONVERT_BASE_COMMAND::convertInChildProcesses( const std::vector<wxString>& aInputs,
+                                                        const std::vector<wxString>& aOutputs,
+                                                        const wxString& aFormat )
+{
+    wxString exe = wxStandardPaths::Get().GetExecutablePath();
+    size_t   maxRunning = std::max( 1u, std::thread::hardware_concurrency() );
+    size_t   next = 0;
+    size_t   finished = 0;
+    size_t   failed = 0;
+
+    std::vector<std::unique_ptr<CONVERT_PROCESS>> running;
+
+    // wxExecute() must only be called from the main thread, so the children are started
+    // asynchronously and their termination is picked up by an event loop, which kicad-cli
+    // doesn't otherwise run.
+    wxEventLoopBase*                 loop = wxEventLoopBase::GetActive();
+    std::unique_ptr<wxEventLoopBase> ownLoop;
+
+    if( !loop )
+    {
+        ownLoop.reset( wxTheApp->GetTraits()->CreateEventLoop() );
+        loop = ownLoop.get();
+    }
+
+    wxEventLoopActivator activator( loop );
+
+    auto report =
+            [&]( size_t aIndex, int aExitCode, const wxString& aErrors )
+            {
+                wxPrintf( wxS( "[%zu/%zu] %s: " ), ++finished, aInputs.size(), aInputs[aIndex] );
+
+                if( aExitCode == EXIT_CODES::SUCCESS )
+                {
+                    wxPrintf( _( "converted to '%s'\n" ), aOutputs[aIndex] );
+                    return;
+                }
+
+                failed++;
+                wxPrintf( _( "failed (exit code %d)\n" ), aExitCode );
+
+                wxArrayString lines = wxSplit( aErrors.Trim(), '\n', '\0' );
+
+                for( const wxString& line : lines )
+                    wxPrintf( wxS( "    %s\n" ), line );
+            };
+
+    while( next < aInputs.size() || !running.empty() )
+    {
+        // Keep one child per core busy
+        while( next < aInputs.size() && running.size() < maxRunning )
+        {
+            wxFileName output = aOutputs[next];
+            wxString   cmd = wxString::Format( wxS( "\"%s\" %s %s -o \"%s\"" ), exe,
+                                               m_parentName, m_name, output.GetPath() );
+
+            if( !aFormat.IsEmpty() )
+                cmd << wxString::Format( wxS( " %s \"%s\"" ), ARG_FORMAT, aFormat );
+
+            cmd << wxString::Format( wxS( " \"%s\"" ), aInputs[next] );
+
+            auto process = std::make_unique<CONVERT_PROCESS>( next );
+
+            if( wxExecute( cmd, wxEXEC_ASYNC | wxEXEC_HIDE_CONSOLE, process.get() ) > 0 )
+                running.push_back( std::move( process ) );
+            else
+                report( next, EXIT_CODES::ERR_UNKNOWN, _( "Unable to start kicad-cli" ) );
+
+            next++;
+        }
+
+        loop->DispatchTimeout( 50 );
+
+        for( auto it = running.begin(); it != running.end(); )
+        {
+            CONVERT_PROCESS* process = it->get();
+
+            process->ReadOutput();
+
+            if( !process->IsFinished() )
+            {
+                ++it;
+                continue;
+            }
+
+            report( process->GetIndex(), process->GetExitCode(), process->GetErrors() );
+            it = running.erase( it );
+        }
+    }
+
+    wxPrintf( _( "Converted %zu of %zu files\n" ), aInputs.size() - failed, aInputs.size() );
+
+    return failed ? EXIT_CODES::ERR_INVALID_INPUT_FILE : EXIT_CODES::OK;
+}
@@ -0,0 +1,77 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMMAND_CONVERT_BASE_H
+#define COMMAND_CONVERT_BASE_H
+
+#include "command.h"
+
+#include <vector>
+
+namespace CLI
+{
+/**
+ * Common part of the commands converting designs from other tools to the KiCad format.
+ *
+ * A single input file is converted in this process.  When several files are given, each one
+ * is converted by a child kicad-cli process: the importers rely on process wide state (the
+ * numeric locale, the loaded projects) and cannot run concurrently in one process.  At most
+ * one child per core runs at a time.
+ */
+class CONVERT_BASE_COMMAND : public COMMAND
+{
+public:
+    /**
+     * @param aParentName is the name of the command this one is registered under.
+     */
+    CONVERT_BASE_COMMAND( const std::string& aParentName );
+
+protected:
+    int doPerform( KIWAY& aKiway ) override;
+
+    /**
+     * Convert \a aInput to \a aOutput in this process.
+     *
+     * @param aFormat is the importer name given by the user, empty to guess it from the file.
+     */
+    virtual int convertFile( KIWAY& aKiway, const wxString& aInput, const wxString& aOutput,
+                             const wxString& aFormat ) = 0;
+
+    /**
+     * @return the extension of the converted files.
+     */
+    virtual wxString outputExtension() const = 0;
+
+    /**
+     * @return true if a converted design can be written to more than one file, e.g. the sub
+     *         sheets of a schematic.  When several such designs are converted at once, each one
+     *         goes to a folder of its own so that their files cannot overwrite each other.
+     */
+    virtual bool hasExtraOutputFiles() const { return false; }
+
+private:
+    int convertInChildProcesses( const std::vector<wxString>& aInputs,
+                                 const std::vector<wxString>& aOutputs,
+                                 const wxString& aFormat );
+
+    std::string m_parentName;
+};
+} // namespace CLI
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command_pcb_convert.h"
+#include "jobs/job_pcb_convert.h"
+#include <kiface_base.h>
+#include <wildcards_and_files_ext.h>
+
+#include <macros.h>
+
+
+CLI::PCB_CONVERT_COMMAND::PCB_CONVERT_COMMAND() :
+        CONVERT_BASE_COMMAND( "pcb" )
+{
+    m_argParser.add_description( UTF8STDSTR( _( "Converts boards from other EDA tools to the "
+                                                "KiCad format" ) ) );
+}
+
+
+int CLI::PCB_CONVERT_COMMAND::convertFile( KIWAY& aKiway, const wxString& aInput,
+                                          const wxString& aOutput, const wxString& aFormat )
+{
+    std::unique_ptr<JOB_PCB_CONVERT> convertJob = std::make_unique<JOB_PCB_CONVERT>( true );
+
+    convertJob->m_filename = aInput;
+    convertJob->m_outputFile = aOutput;
+    convertJob->m_format = aFormat;
+
+    return aKiway.ProcessJob( KIWAY::FACE_PCB, convertJob.get() );
+}
+
+
+wxString CLI::PCB_CONVERT_COMMAND::outputExtension() const
+{
+    return FILEEXT::KiCadPcbFileExtension;
+}
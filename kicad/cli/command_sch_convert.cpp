@@ -0,0 +1,52 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command_sch_convert.h"
+#include "jobs/job_sch_convert.h"
+#include <kiface_base.h>
+#include <wildcards_and_files_ext.h>
+
+#include <macros.h>
+
+
+CLI::SCH_CONVERT_COMMAND::SCH_CONVERT_COMMAND() :
+        CONVERT_BASE_COMMAND( "sch" )
+{
+    m_argParser.add_description( UTF8STDSTR( _( "Converts schematics from other EDA tools to the "
+                                                "KiCad format" ) ) );
+}
+
+
+int CLI::SCH_CONVERT_COMMAND::convertFile( KIWAY& aKiway, const wxString& aInput,
+                                          const wxString& aOutput, const wxString& aFormat )
+{
+    std::unique_ptr<JOB_SCH_CONVERT> convertJob = std::make_unique<JOB_SCH_CONVERT>( true );
+
+    convertJob->m_filename = aInput;
+    convertJob->m_outputFile = aOutput;
+    convertJob->m_format = aFormat;
+
+    return aKiway.ProcessJob( KIWAY::FACE_SCH, convertJob.get() );
+}
+
+
+wxString CLI::SCH_CONVERT_COMMAND::outputExtension() const
+{
+    return FILEEXT::KiCadSchematicFileExtension;
+}
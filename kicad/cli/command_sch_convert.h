@@ -0,0 +1,42 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMMAND_SCH_CONVERT_H
+#define COMMAND_SCH_CONVERT_H
+
+#include "command_convert_base.h"
+
+namespace CLI
+{
+class SCH_CONVERT_COMMAND : public CONVERT_BASE_COMMAND
+{
+public:
+    SCH_CONVERT_COMMAND();
+
+protected:
+    int convertFile( KIWAY& aKiway, const wxString& aInput, const wxString& aOutput,
+                     const wxString& aFormat ) override;
+
+    wxString outputExtension() const override;
+
+    bool hasExtraOutputFiles() const override { return true; }
+};
+} // namespace CLI
+
+#endif
@@ -47,6 +47,7 @@
 #include <locale_io.h>
 
 #include "cli/command_pcb.h"
+#include "cli/command_pcb_convert.h"
 #include "cli/command_pcb_export.h"
 #include "cli/command_pcb_drc.h"
 #include "cli/command_pcb_export_3d.h"
@@ -67,6 +68,7 @@
 #include "cli/command_fp_export_svg.h"
 #include "cli/command_fp_upgrade.h"
 #include "cli/command_sch.h"
+#include "cli/command_sch_convert.h"
 #include "cli/command_sch_erc.h"
 #include "cli/command_sch_export.h"
 #include "cli/command_sym.h"
@@ -127,6 +129,7 @@ struct COMMAND_ENTRY
 };
 
 static CLI::PCB_COMMAND                  pcbCmd{};
+static CLI::PCB_CONVERT_COMMAND          pcbConvertCmd{};
 static CLI::PCB_DRC_COMMAND              pcbDrcCmd{};
 static CLI::PCB_EXPORT_DRILL_COMMAND     exportPcbDrillCmd{};
 static CLI::PCB_EXPORT_DXF_COMMAND       exportPcbDxfCmd{};
@@ -142,6 +145,7 @@ static CLI::PCB_EXPORT_IPC2581_COMMAND   exportPcbIpc2581Cmd{};
 static CLI::PCB_EXPORT_COMMAND           exportPcbCmd{};
 static CLI::SCH_EXPORT_COMMAND           exportSchCmd{};
 static CLI::SCH_COMMAND                  schCmd{};
+static CLI::SCH_CONVERT_COMMAND          schConvertCmd{};
 static CLI::SCH_ERC_COMMAND              schErcCmd{};
 static CLI::SCH_EXPORT_BOM_COMMAND       exportSchBomCmd{};
 static CLI::SCH_EXPORT_PYTHONBOM_COMMAND exportSchPythonBomCmd{};
@@ -180,6 +184,9 @@ static std::vector<COMMAND_ENTRY> commandStack = {
     {
         &pcbCmd,
         {
+            {
+                &pcbConvertCmd
+            },
             {
                 &pcbDrcCmd
             },
@@ -204,6 +211,9 @@ static std::vector<COMMAND_ENTRY> commandStack = {
     {
         &schCmd,
         {
+            {
+                &schConvertCmd
+            },
             {
                 &schErcCmd
             },
@@ -25,6 +25,8 @@
 #ifndef INCLUDE_THREAD_POOL_H_
 #define INCLUDE_THREAD_POOL_H_
 
+#include <functional>
+
 #include <bs_thread_pool.hpp>
 
 using thread_pool = BS::thread_pool;
@@ -39,4 +41,18 @@ using thread_pool = BS::thread_pool;
 thread_pool& GetKiCadThreadPool();
 
 
+/**
+ * Run \a aFunction for every index in [0, aCount) on the KiCad thread pool.
+ *
+ * The indices are handed out in increasing order, so callers control the scheduling order
+ * by the order of their work items.  The calling thread works through the indices too, and
+ * then only waits for the ones already picked up by a worker.  This keeps it safe to call from
+ * a task which is itself running on the pool, where waiting for queued tasks could deadlock.
+ *
+ * If \a aFunction throws, the indices not started yet are skipped and the first exception is
+ * rethrown to the caller once all the running ones have returned.
+ */
+void RunOnThreadPool( size_t aCount, const std::function<void( size_t )>& aFunction );
+
+
 #endif /* INCLUDE_THREAD_POOL_H_ */
@@ -22,6 +22,13 @@
  */
 
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
 #include <core/thread_pool.h>
 
 // Under mingw, there is a problem with the destructor when creating a static instance
@@ -39,3 +46,76 @@ thread_pool& GetKiCadThreadPool()
 
     return *tp;
 }
+
+
+void RunOnThreadPool( size_t aCount, const std::function<void( size_t )>& aFunction )
+{
+    if( aCount == 0 )
+        return;
+
+    struct JOBS
+    {
+        std::atomic<size_t>                next{ 0 };
+        std::atomic<size_t>                done{ 0 };
+        std::atomic<bool>                  failed{ false };
+        size_t                             count = 0;
+        std::function<void( size_t )>      function;
+        std::exception_ptr                 exception;     ///< The first one thrown
+        std::mutex                         mutex;
+        std::condition_variable            finished;
+    };
+
+    // Workers which start after the last index was taken only touch the shared counters, so
+    // they must not reference anything on this stack frame.
+    std::shared_ptr<JOBS> jobs = std::make_shared<JOBS>();
+
+    jobs->count = aCount;
+    jobs->function = aFunction;
+
+    auto worker =
+            [jobs]()
+            {
+                for( size_t ii = jobs->next++; ii < jobs->count; ii = jobs->next++ )
+                {
+                    // An exception must neither leave the caller waiting for its index nor
+                    // unwind the caller's frame while other workers still use it.  It is kept
+                    // and rethrown once every index is done; the remaining ones are skipped.
+                    if( !jobs->failed )
+                    {
+                        try
+                        {
+                            jobs->function( ii );
+                        }
+                        catch( ... )
+                        {
+                            std::lock_guard<std::mutex> lock( jobs->mutex );
+
+                            if( !jobs->exception )
+                                jobs->exception = std::current_exception();
+
+                            jobs->failed = true;
+                        }
+                    }
+
+                    if( ++jobs->done == jobs->count )
+                    {
+                        std::lock_guard<std::mutex> lock( jobs->mutex );
+                        jobs->finished.notify_all();
+                    }
+                }
+            };
+
+    thread_pool& pool = GetKiCadThreadPool();
+    size_t       helpers = std::min<size_t>( aCount, pool.get_thread_count() ) - 1;
+
+    for( size_t ii = 0; ii < helpers; ++ii )
+        pool.push_task( worker );
+
+    worker();
+
+    std::unique_lock<std::mutex> lock( jobs->mutex );
+    jobs->finished.wait( lock, [&]() { return jobs->done == jobs->count; } );
+
+    if( jobs->exception )
+        std::rethrow_exception( jobs->exception );
+}
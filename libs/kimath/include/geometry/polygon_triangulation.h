@@ -47,8 +47,10 @@
 #define __POLYGON_TRIANGULATION_H
 
 #include <algorithm>
-#include <deque>
 #include <cmath>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include <clipper.hpp>
 #include <geometry/shape_line_chain.h>
@@ -62,7 +64,28 @@ class POLYGON_TRIANGULATION
 public:
     POLYGON_TRIANGULATION( SHAPE_POLY_SET::TRIANGULATED_POLYGON& aResult ) :
         m_result( aResult )
-    {};
+    {
+        // Reuse the vertex storage of this thread, unless another triangulation is using it
+        static thread_local VERTEX_POOL threadPool;
+
+        if( !threadPool.m_InUse )
+        {
+            m_pool = &threadPool;
+        }
+        else
+        {
+            m_ownPool = std::make_unique<VERTEX_POOL>();
+            m_pool = m_ownPool.get();
+        }
+
+        m_pool->m_InUse = true;
+    };
+
+    ~POLYGON_TRIANGULATION()
+    {
+        m_pool->Release();
+        m_pool->m_InUse = false;
+    }
 
     bool TesselatePolygon( const SHAPE_LINE_CHAIN& aPoly,
                            SHAPE_POLY_SET::TRIANGULATED_POLYGON* aHintData )
@@ -86,12 +109,16 @@ public:
         if( aHintData )
         {
             m_result.Triangles() = aHintData->Triangles();
+
+            for( SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRI& tri : m_result.Triangles() )
+                tri.parent = &m_result;
+
             return true;
         }
         else
         {
             auto retval = earcutList( firstVertex );
-            m_vertices.clear();
+            m_pool->Release();
             return retval;
         }
     }
@@ -129,10 +156,8 @@ private:
          */
         VERTEX* split( VERTEX* b )
         {
-            parent->m_vertices.emplace_back( i, x, y, parent );
-            VERTEX* a2 = &parent->m_vertices.back();
-            parent->m_vertices.emplace_back( b->i, b->x, b->y, parent );
-            VERTEX* b2 = &parent->m_vertices.back();
+            VERTEX* a2 = parent->m_pool->Create( i, x, y, parent );
+            VERTEX* b2 = parent->m_pool->Create( b->i, b->x, b->y, parent );
             VERTEX* an = next;
             VERTEX* bp = b->prev;
 
@@ -212,8 +237,9 @@ private:
          */
         void zSort()
         {
-            std::deque<VERTEX*> queue;
+            std::vector<VERTEX*>& queue = parent->m_pool->m_SortBuffer;
 
+            queue.clear();
             queue.push_back( this );
 
             for( auto p = next; p && p != this; p = p->next )
@@ -275,6 +301,65 @@ private:
         VERTEX* nextZ = nullptr;
     };
 
+    /**
+     * Storage for the vertices of the linked lists.
+     *
+     * Vertices are linked by pointer so they never move once created.  They are allocated in
+     * blocks which are kept from one triangulation to the next, so that triangulating on a
+     * given thread stops allocating once the pool has grown to the size of its polygons.
+     */
+    class VERTEX_POOL
+    {
+    public:
+        template <typename... ARGS>
+        VERTEX* Create( ARGS&&... aArgs )
+        {
+            size_t block = m_used / BLOCK_SIZE;
+
+            if( block == m_blocks.size() )
+                m_blocks.push_back( std::make_unique<SLOT[]>( BLOCK_SIZE ) );
+
+            SLOT* slot = &m_blocks[block][m_used % BLOCK_SIZE];
+            m_used++;
+
+            return new( slot ) VERTEX( std::forward<ARGS>( aArgs )... );
+        }
+
+        /**
+         * Forget all the vertices, and give back the memory beyond what is worth keeping.
+         */
+        void Release()
+        {
+            m_used = 0;
+
+            if( m_blocks.size() > MAX_KEPT_BLOCKS )
+                m_blocks.resize( MAX_KEPT_BLOCKS );
+
+            if( m_SortBuffer.capacity() > MAX_KEPT_BLOCKS * BLOCK_SIZE )
+                std::vector<VERTEX*>().swap( m_SortBuffer );
+        }
+
+        ///< Scratch buffer for sorting vertices in z-order
+        std::vector<VERTEX*> m_SortBuffer;
+
+        bool m_InUse = false;
+
+    private:
+        // Vertices are not destroyed when the pool is released
+        static_assert( std::is_trivially_destructible_v<VERTEX> );
+
+        struct alignas( VERTEX ) SLOT
+        {
+            unsigned char m_Data[sizeof( VERTEX )];
+        };
+
+        static constexpr size_t BLOCK_SIZE = 1024;
+        static constexpr size_t MAX_KEPT_BLOCKS = 64;
+
+        std::vector<std::unique_ptr<SLOT[]>> m_blocks;
+        size_t                               m_used = 0;
+    };
+
     /**
      * Calculate the Morton code of the Vertex
      * http://www.graphics.stanford.edu/~seander/bithacks.html#InterleaveBMN
@@ -792,9 +877,8 @@ private:
     VERTEX* insertVertex( const VECTOR2I& pt, VERTEX* last )
     {
         m_result.AddVertex( pt );
-        m_vertices.emplace_back( m_result.GetVertexCount() - 1, pt.x, pt.y, this );
 
-        VERTEX* p = &m_vertices.back();
+        VERTEX* p = m_pool->Create( m_result.GetVertexCount() - 1, pt.x, pt.y, this );
 
         if( !last )
         {
@@ -813,7 +897,8 @@ private:
 
 private:
     BOX2I                                 m_bbox;
-    std::deque<VERTEX>                    m_vertices;
+    VERTEX_POOL*                          m_pool;
+    std::unique_ptr<VERTEX_POOL>          m_ownPool;
     SHAPE_POLY_SET::TRIANGULATED_POLYGON& m_result;
 };
 
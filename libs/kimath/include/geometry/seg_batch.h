@@ -0,0 +1,85 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#ifndef __SEG_BATCH_H
+#define __SEG_BATCH_H
+
+#include <cstdint>
+#include <vector>
+
+#include <geometry/seg.h>
+
+class SHAPE;
+
+/**
+ * A batch of thick segments (a circle being a segment of zero length) tested together against
+ * a single reference segment.
+ *
+ * The coordinates are kept as separate arrays so that the distance computations of the whole
+ * batch run as one branch-free loop which the compiler can vectorize.  The test is a
+ * conservative filter: an entry which is rejected is guaranteed not to collide with the
+ * reference, an accepted one still has to be checked with the exact SHAPE::Collide().
+ */
+class SEG_BATCH
+{
+public:
+    SEG_BATCH() {}
+
+    void Clear();
+
+    void Reserve( size_t aCount );
+
+    /**
+     * Add a segment of \a aRadius half width (or a circle if \a aSeg is a single point).
+     */
+    void Add( const SEG& aSeg, int aRadius );
+
+    size_t Size() const { return m_radius.size(); }
+
+    /**
+     * Flag the entries which may be closer than \a aClearance to \a aRef, thickened by
+     * \a aRefRadius.
+     *
+     * @param aResult is resized to the batch size and receives 1 for the entries which may
+     *                collide and 0 for the ones which cannot.
+     * @return the number of entries which may collide.
+     */
+    size_t MayCollide( const SEG& aRef, int aRefRadius, int aClearance,
+                       std::vector<uint8_t>& aResult ) const;
+
+    /**
+     * Get the segment and half width of a SHAPE_SEGMENT or SHAPE_CIRCLE.
+     *
+     * @return false if \a aShape is any other kind of shape.
+     */
+    static bool AsSegment( const SHAPE* aShape, SEG& aSeg, int& aRadius );
+
+private:
+    std::vector<double> m_ax;
+    std::vector<double> m_ay;
+    std::vector<double> m_bx;
+    std::vector<double> m_by;
+    std::vector<double> m_radius;
+};
+
+#endif // __SEG_BATCH_H
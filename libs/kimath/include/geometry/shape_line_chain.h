@@ -951,6 +951,11 @@ protected:
      */
     void mergeFirstLastPointIfNeeded();
 
+    /**
+     * Test segments \a s1 < \a s2 of the line chain for a self-intersection.
+     */
+    std::optional<INTERSECTION> selfIntersection( int s1, int s2 ) const;
+
 private:
 
     static const ssize_t SHAPE_IS_PT;
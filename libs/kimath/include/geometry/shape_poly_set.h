@@ -158,8 +158,15 @@ public:
         int GetSourceOutlineIndex() const { return m_sourceOutline; }
         void SetSourceOutlineIndex( int aIndex ) { m_sourceOutline = aIndex; }
 
-        std::deque<TRI>& Triangles() { return m_triangles; }
-        const std::deque<TRI>& Triangles() const { return m_triangles; }
+        /**
+         * The hash of the partition this triangulation was built from, used to reuse it when
+         * only other parts of the polygon set have changed.
+         */
+        const MD5_HASH& GetSourceHash() const { return m_sourceHash; }
+        void SetSourceHash( const MD5_HASH& aHash ) { m_sourceHash = aHash; }
+
+        std::vector<TRI>& Triangles() { return m_triangles; }
+        const std::vector<TRI>& Triangles() const { return m_triangles; }
 
         size_t GetVertexCount() const
         {
@@ -173,9 +180,10 @@ public:
         }
 
     private:
-        int                  m_sourceOutline;
-        std::deque<TRI>      m_triangles;
-        std::deque<VECTOR2I> m_vertices;
+        int                   m_sourceOutline;
+        MD5_HASH              m_sourceHash;
+        std::vector<TRI>      m_triangles;
+        std::vector<VECTOR2I> m_vertices;
     };
 
     /**
@@ -291,7 +299,7 @@ public:
 
         const T& Get()
         {
-            return m_poly->Polygon( m_currentPolygon )[m_currentContour].CPoint( m_currentVertex );
+            return m_poly->CPolygon( m_currentPolygon )[m_currentContour].CPoint( m_currentVertex );
         }
 
         const T& operator*()
@@ -407,7 +415,7 @@ public:
 
         T Get()
         {
-            return m_poly->Polygon( m_currentPolygon )[m_currentContour].Segment( m_currentSegment );
+            return m_poly->CPolygon( m_currentPolygon )[m_currentContour].Segment( m_currentSegment );
         }
 
         T operator*()
@@ -523,6 +531,14 @@ public:
     }
     bool IsTriangulationUpToDate() const;
 
+    /**
+     * Let the next CacheTriangulation() call reuse the triangles of \a aPrevious, typically a
+     * previous version of this polygon set, for the partitions which did not change.
+     *
+     * This set stays untriangulated until then, and \a aPrevious is only kept until it is used.
+     */
+    void InheritTriangulation( std::shared_ptr<const SHAPE_POLY_SET> aPrevious );
+
     MD5_HASH GetHash() const;
 
     virtual bool HasIndexableSubshapes() const override;
@@ -693,9 +709,10 @@ public:
         return m_polys[aOutline].size() - 1;
     }
 
-    /// Return the reference to aIndex-th outline in the set
+    /// Return the reference to aIndex-th outline in the set.  Use COutline() to only read it.
     SHAPE_LINE_CHAIN& Outline( int aIndex )
     {
+        ClearEdgeIndex();
         return m_polys[aIndex][0];
     }
 
@@ -723,12 +740,14 @@ public:
     /// Return the reference to aHole-th hole in the aIndex-th outline
     SHAPE_LINE_CHAIN& Hole( int aOutline, int aHole )
     {
+        ClearEdgeIndex();
         return m_polys[aOutline][aHole + 1];
     }
 
     /// Return the aIndex-th subpolygon in the set
     POLYGON& Polygon( int aIndex )
     {
+        ClearEdgeIndex();
         return m_polys[aIndex];
     }
 
@@ -1006,6 +1025,51 @@ public:
     void BooleanXor( const SHAPE_POLY_SET& a, const SHAPE_POLY_SET& b,
                               POLYGON_MODE aFastMode );
 
+    /**
+     * A sequence of boolean operations on a polygon set.
+     *
+     * The intermediate results stay in Clipper form instead of being converted back to a
+     * SHAPE_POLY_SET after every operation, and consecutive unions (or differences) are
+     * carried out as a single operation with all their operands.  The result is only built
+     * by Finish().  If no operation is requested, Finish() gives back the subject unchanged.
+     *
+     * The subject must not be modified or destroyed before Finish(), unless it is the
+     * result.  As for the Boolean*() functions, the polygons must not have arcs.
+     */
+    class BOOLEAN_SESSION
+    {
+    public:
+        BOOLEAN_SESSION( const SHAPE_POLY_SET& aSubject, POLYGON_MODE aFastMode );
+
+        void Add( const SHAPE_POLY_SET& aOther );
+        void Subtract( const SHAPE_POLY_SET& aOther );
+        void Intersect( const SHAPE_POLY_SET& aOther );
+
+        /// Store the result of the operations in \a aResult, which may be the subject.
+        void Finish( SHAPE_POLY_SET& aResult );
+
+    private:
+        /// Convert the subject on the first operation
+        void start();
+        void addOperand( Clipper2Lib::ClipType aType, const SHAPE_POLY_SET& aOther );
+        void appendPaths( const SHAPE_POLY_SET& aSet, Clipper2Lib::Paths64& aPaths );
+        void execute( Clipper2Lib::Paths64* aPaths, Clipper2Lib::PolyTree64* aTree );
+
+        const SHAPE_POLY_SET*           m_source;
+        POLYGON_MODE                    m_mode;
+        bool                            m_started;
+
+        ///< The polygon set the operations are applied to, when Clipper2 is not in use
+        std::unique_ptr<SHAPE_POLY_SET> m_legacy;
+
+        Clipper2Lib::Paths64            m_subject;
+        Clipper2Lib::Paths64            m_clips;
+        Clipper2Lib::ClipType           m_pendingType;
+        bool                            m_pending;
+        std::vector<CLIPPER_Z_VALUE>    m_zValues;
+        std::vector<SHAPE_ARC>          m_arcBuffer;
+    };
+
     /**
     * Extract all contours from this polygon set, then recreate polygons with holes.
     * Essentially XOR'ing, but faster. Self-intersecting polygons are not supported.
@@ -1229,6 +1293,26 @@ public:
 
     const BOX2I BBoxFromCaches() const;
 
+    /**
+     * Build the edge indexes of the large contours of the set, if they are not built yet.
+     *
+     * Contains(), PointInside(), the point and segment Collide() and the SquaredDistance()
+     * queries then only visit the edges near the query instead of every edge of the contour.
+     *
+     * @note The indexes are dropped by the editing methods of the polygon set and by the
+     *       non-const Outline(), Hole() and Polygon() accessors, so COutline(), CHole() and
+     *       CPolygon() must be used to read a set which is queried from other threads.  Copies
+     *       of the set do not keep the indexes.
+     */
+    void BuildEdgeIndex() const;
+
+    /**
+     * Drop the edge indexes built by BuildEdgeIndex().
+     */
+    void ClearEdgeIndex() const;
+
+    bool HasEdgeIndex() const { return m_edgeIndex != nullptr; }
+
     /**
      * Return true if a given subpolygon contains the point \a aP.
      *
@@ -1531,6 +1615,24 @@ private:
     /// Return true if the polygon set has any holes that touch share a vertex.
     bool hasTouchingHoles( const POLYGON& aPoly ) const;
 
+    /**
+     * Point in contour test of contour \a aContour of polygon \a aPoly, using its edge index
+     * if it has one.
+     */
+    bool pointInsideContour( int aPoly, int aContour, const VECTOR2I& aPt, int aAccuracy,
+                             bool aUseBBoxCache ) const;
+
+    /**
+     * Find the edge of polygon \a aPolygonIndex with the smallest \a aDistance() to a query
+     * spanning \a aMinY to \a aMaxY, using the edge index.  \a aNearest() is called with the
+     * nearest edge.
+     *
+     * @return the squared distance to the nearest edge.
+     */
+    template <typename DIST_FUNC, typename NEAREST_FUNC>
+    SEG::ecoord nearestEdge( int aPolygonIndex, int aMinY, int aMaxY, DIST_FUNC&& aDistance,
+                             NEAREST_FUNC&& aNearest ) const;
+
     MD5_HASH checksum() const;
 
 protected:
@@ -1541,6 +1643,13 @@ protected:
 
 private:
     MD5_HASH m_hash;
+
+    ///< Polygon set whose triangles the next triangulation may reuse, see InheritTriangulation()
+    std::shared_ptr<const SHAPE_POLY_SET> m_triangulationDonor;
+
+    struct EDGE_INDEX;
+
+    mutable std::unique_ptr<EDGE_INDEX> m_edgeIndex;
 };
 
 #endif // __SHAPE_POLY_SET_H
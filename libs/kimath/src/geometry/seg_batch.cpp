@@ -0,0 +1,168 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include <algorithm>
+
+#include <geometry/seg_batch.h>
+#include <geometry/shape_circle.h>
+#include <geometry/shape_segment.h>
+
+
+///< Slack added to the collision distance to cover the rounding of the integer collision code
+static const double SEG_BATCH_MARGIN = 2.0;
+
+
+void SEG_BATCH::Clear()
+{
+    m_ax.clear();
+    m_ay.clear();
+    m_bx.clear();
+    m_by.clear();
+    m_radius.clear();
+}
+
+
+void SEG_BATCH::Reserve( size_t aCount )
+{
+    m_ax.reserve( aCount );
+    m_ay.reserve( aCount );
+    m_bx.reserve( aCount );
+    m_by.reserve( aCount );
+    m_radius.reserve( aCount );
+}
+
+
+void SEG_BATCH::Add( const SEG& aSeg, int aRadius )
+{
+    m_ax.push_back( aSeg.A.x );
+    m_ay.push_back( aSeg.A.y );
+    m_bx.push_back( aSeg.B.x );
+    m_by.push_back( aSeg.B.y );
+    m_radius.push_back( aRadius );
+}
+
+
+/**
+ * Squared distance from the point \a aPx, \a aPy to the segment going from the origin to
+ * \a aDx, \a aDy, whose squared length is \a aLenSq.
+ */
+static inline double pointToSegDistSq( double aPx, double aPy, double aDx, double aDy,
+                                       double aLenSq )
+{
+    double t = aLenSq > 0.0 ? ( aPx * aDx + aPy * aDy ) / aLenSq : 0.0;
+
+    t = std::min( std::max( t, 0.0 ), 1.0 );
+
+    double ex = aPx - t * aDx;
+    double ey = aPy - t * aDy;
+
+    return ex * ex + ey * ey;
+}
+
+
+size_t SEG_BATCH::MayCollide( const SEG& aRef, int aRefRadius, int aClearance,
+                              std::vector<uint8_t>& aResult ) const
+{
+    const size_t count = Size();
+
+    aResult.resize( count );
+
+    // Everything is computed relative to the start of the reference segment, which keeps the
+    // magnitudes (and so the rounding errors) down to the size of the query area.
+    const double originX = aRef.A.x;
+    const double originY = aRef.A.y;
+    const double dx = (double) aRef.B.x - originX;
+    const double dy = (double) aRef.B.y - originY;
+    const double refLenSq = dx * dx + dy * dy;
+    const double reach = (double) aClearance + aRefRadius + SEG_BATCH_MARGIN;
+
+    const double* ax = m_ax.data();
+    const double* ay = m_ay.data();
+    const double* bx = m_bx.data();
+    const double* by = m_by.data();
+    const double* radius = m_radius.data();
+    uint8_t*      result = aResult.data();
+
+    for( size_t ii = 0; ii < count; ++ii )
+    {
+        const double qax = ax[ii] - originX;
+        const double qay = ay[ii] - originY;
+        const double qbx = bx[ii] - originX;
+        const double qby = by[ii] - originY;
+        const double ex = qbx - qax;
+        const double ey = qby - qay;
+        const double lenSq = ex * ex + ey * ey;
+
+        double distSq = std::min( pointToSegDistSq( qax, qay, dx, dy, refLenSq ),
+                                  pointToSegDistSq( qbx, qby, dx, dy, refLenSq ) );
+
+        distSq = std::min( distSq, pointToSegDistSq( -qax, -qay, ex, ey, lenSq ) );
+        distSq = std::min( distSq, pointToSegDistSq( dx - qax, dy - qay, ex, ey, lenSq ) );
+
+        // Segments crossing each other are at distance zero whatever their end points
+        const double sideA = dx * qay - dy * qax;
+        const double sideB = dx * qby - dy * qbx;
+        const double sideC = ey * qax - ex * qay;
+        const double sideD = ex * ( dy - qay ) - ey * ( dx - qax );
+        const bool   crossing = ( sideA * sideB < 0.0 ) & ( sideC * sideD < 0.0 );
+
+        const double limit = reach + radius[ii];
+
+        result[ii] = crossing | ( limit < 0.0 ) | ( distSq <= limit * limit );
+    }
+
+    size_t candidates = 0;
+
+    for( size_t ii = 0; ii < count; ++ii )
+        candidates += result[ii];
+
+    return candidates;
+}
+
+
+bool SEG_BATCH::AsSegment( const SHAPE* aShape, SEG& aSeg, int& aRadius )
+{
+    switch( aShape->Type() )
+    {
+    case SH_SEGMENT:
+    {
+        const SHAPE_SEGMENT* segment = static_cast<const SHAPE_SEGMENT*>( aShape );
+
+        aSeg = segment->GetSeg();
+        aRadius = segment->GetWidth() / 2;
+        return true;
+    }
+
+    case SH_CIRCLE:
+    {
+        const SHAPE_CIRCLE* circle = static_cast<const SHAPE_CIRCLE*>( aShape );
+
+        aSeg = SEG( circle->GetCenter(), circle->GetCenter() );
+        aRadius = circle->GetRadius();
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
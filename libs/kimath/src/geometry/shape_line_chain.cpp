@@ -24,6 +24,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
+#include <algorithm>
 #include <limits>
 #include <math.h>            // for hypot
 #include <map>
@@ -1495,97 +1496,230 @@ static inline void addIntersection( SHAPE_LINE_CHAIN::INTERSECTIONS& aIps, int a
 }
 
 
-int SHAPE_LINE_CHAIN::Intersect( const SHAPE_LINE_CHAIN& aChain, INTERSECTIONS& aIp,
-                                 bool aExcludeColinearAndTouching, BOX2I* aChainBBox ) const
+/// Below this many segments (or segment pairs for Intersect()), the all-pairs tests are faster
+/// than sorting the segments for a sweep.
+static const int SWEEP_MIN_SEGMENTS = 32;
+
+
+/**
+ * The bounding box of a segment of a line chain, as used by the sorted sweeps below.
+ */
+struct SWEEP_SEGMENT
+{
+    int  m_MinX;
+    int  m_MaxX;
+    int  m_MinY;
+    int  m_MaxY;
+    int  m_Index;
+    bool m_Ours;
+};
+
+
+static void addSweepSegments( const SHAPE_LINE_CHAIN& aChain, bool aOurs,
+                              std::vector<SWEEP_SEGMENT>& aSegments )
 {
-    BOX2I bb_other = aChainBBox ? *aChainBBox : aChain.BBox();
+    for( int s = 0; s < aChain.SegmentCount(); s++ )
+    {
+        const SEG& seg = aChain.CSegment( s );
 
-    for( int s1 = 0; s1 < SegmentCount(); s1++ )
+        aSegments.push_back( { std::min( seg.A.x, seg.B.x ), std::max( seg.A.x, seg.B.x ),
+                               std::min( seg.A.y, seg.B.y ), std::max( seg.A.y, seg.B.y ),
+                               s, aOurs } );
+    }
+}
+
+
+/**
+ * Call \a aFunc for every pair of segments whose bounding boxes are closer than \a aMargin.
+ *
+ * The segments are sorted by their minimum x, so that the pairs tested for each segment stop
+ * as soon as the following segments start after its maximum x.
+ */
+template <typename Func>
+static void sweepSegmentPairs( std::vector<SWEEP_SEGMENT>& aSegments, int aMargin, Func&& aFunc )
+{
+    std::sort( aSegments.begin(), aSegments.end(),
+               []( const SWEEP_SEGMENT& a, const SWEEP_SEGMENT& b )
+               {
+                   return a.m_MinX < b.m_MinX;
+               } );
+
+    for( size_t ii = 0; ii < aSegments.size(); ++ii )
     {
-        const SEG& a = CSegment( s1 );
-        const BOX2I bb_cur( a.A, a.B - a.A );
+        const SWEEP_SEGMENT& a = aSegments[ii];
 
-        if( !bb_other.Intersects( bb_cur ) )
-            continue;
+        for( size_t jj = ii + 1; jj < aSegments.size(); ++jj )
+        {
+            const SWEEP_SEGMENT& b = aSegments[jj];
+
+            if( (int64_t) b.m_MinX > (int64_t) a.m_MaxX + aMargin )
+                break;
+
+            if( (int64_t) b.m_MinY > (int64_t) a.m_MaxY + aMargin
+                    || (int64_t) a.m_MinY > (int64_t) b.m_MaxY + aMargin )
+            {
+                continue;
+            }
+
+            aFunc( a, b );
+        }
+    }
+}
+
+
+/**
+ * Add the intersections of segment \a s1 of our chain with segment \a s2 of their chain.
+ */
+static void intersectSegments( const SEG& a, const SEG& b, int s1, int s2, int aPointCount,
+                               bool aExcludeColinearAndTouching,
+                               SHAPE_LINE_CHAIN::INTERSECTIONS& aIp )
+{
+    SHAPE_LINE_CHAIN::INTERSECTION is;
+
+    is.index_our = s1;
+    is.index_their = s2;
+    is.is_corner_our = false;
+    is.is_corner_their = false;
+    is.valid = true;
+
+    OPT_VECTOR2I p = a.Intersect( b );
 
-        for( int s2 = 0; s2 < aChain.SegmentCount(); s2++ )
+    bool coll = a.Collinear( b );
+
+    if( coll && ! aExcludeColinearAndTouching )
+    {
+        if( a.Contains( b.A ) )
         {
-            const SEG& b = aChain.CSegment( s2 );
-            INTERSECTION is;
+            is.p = b.A;
+            is.is_corner_their = true;
+            addIntersection( aIp, aPointCount, is );
+        }
 
-            is.index_our = s1;
-            is.index_their = s2;
-            is.is_corner_our = false;
-            is.is_corner_their = false;
-            is.valid = true;
+        if( a.Contains( b.B ) )
+        {
+            is.p = b.B;
+            is.index_their++;
+            is.is_corner_their = true;
+            addIntersection( aIp, aPointCount, is );
+        }
 
-            OPT_VECTOR2I p = a.Intersect( b );
+        if( b.Contains( a.A ) )
+        {
+            is.p = a.A;
+            is.is_corner_our = true;
+            addIntersection( aIp, aPointCount, is );
+        }
 
-            bool coll = a.Collinear( b );
+        if( b.Contains( a.B ) )
+        {
+            is.p = a.B;
+            is.index_our++;
+            is.is_corner_our = true;
+            addIntersection( aIp, aPointCount, is );
+        }
+    }
+    else if( p )
+    {
+        is.p = *p;
+        is.is_corner_our = false;
+        is.is_corner_their = false;
 
-            if( coll && ! aExcludeColinearAndTouching )
+        if( p == a.A )
+        {
+            is.is_corner_our = true;
+        }
+
+        if( p == a.B )
+        {
+            is.is_corner_our = true;
+            is.index_our++;
+        }
+
+        if( p == b.A )
+        {
+            is.is_corner_their = true;
+        }
+
+        if( p == b.B )
+        {
+            is.is_corner_their = true;
+            is.index_their++;
+        }
+
+        addIntersection( aIp, aPointCount, is );
+    }
+}
+
+
+int SHAPE_LINE_CHAIN::Intersect( const SHAPE_LINE_CHAIN& aChain, INTERSECTIONS& aIp,
+                                 bool aExcludeColinearAndTouching, BOX2I* aChainBBox ) const
+{
+    BOX2I bb_other = aChainBBox ? *aChainBBox : aChain.BBox();
+
+    auto overlapsOther =
+            [&]( const SEG& a )
             {
-                if( a.Contains( b.A ) )
-                {
-                    is.p = b.A;
-                    is.is_corner_their = true;
-                    addIntersection(aIp, PointCount(), is);
-                }
+                const BOX2I bb_cur( a.A, a.B - a.A );
+                return bb_other.Intersects( bb_cur );
+            };
 
-                if( a.Contains( b.B ) )
-                {
-                    is.p = b.B;
-                    is.index_their++;
-                    is.is_corner_their = true;
-                    addIntersection( aIp, PointCount(), is );
-                }
+    if( (int64_t) SegmentCount() * aChain.SegmentCount()
+            < (int64_t) SWEEP_MIN_SEGMENTS * SWEEP_MIN_SEGMENTS )
+    {
+        for( int s1 = 0; s1 < SegmentCount(); s1++ )
+        {
+            const SEG& a = CSegment( s1 );
 
-                if( b.Contains( a.A ) )
-                {
-                    is.p = a.A;
-                    is.is_corner_our = true;
-                    addIntersection( aIp, PointCount(), is );
-                }
+            if( !overlapsOther( a ) )
+                continue;
 
-                if( b.Contains( a.B ) )
-                {
-                    is.p = a.B;
-                    is.index_our++;
-                    is.is_corner_our = true;
-                    addIntersection( aIp, PointCount(), is );
-                }
+            for( int s2 = 0; s2 < aChain.SegmentCount(); s2++ )
+            {
+                intersectSegments( a, aChain.CSegment( s2 ), s1, s2, PointCount(),
+                                   aExcludeColinearAndTouching, aIp );
             }
-            else if( p )
+        }
+
+        return aIp.size();
+    }
+
+    std::vector<SWEEP_SEGMENT>      segments;
+    std::vector<std::pair<int,int>> candidates;
+
+    segments.reserve( SegmentCount() + aChain.SegmentCount() );
+    addSweepSegments( *this, true, segments );
+    addSweepSegments( aChain, false, segments );
+
+    // SEG::Contains() accepts points up to 1 unit away from the segment
+    sweepSegmentPairs( segments, 1,
+            [&]( const SWEEP_SEGMENT& a, const SWEEP_SEGMENT& b )
             {
-                is.p = *p;
-                is.is_corner_our = false;
-                is.is_corner_their = false;
+                if( a.m_Ours && !b.m_Ours )
+                    candidates.emplace_back( a.m_Index, b.m_Index );
+                else if( b.m_Ours && !a.m_Ours )
+                    candidates.emplace_back( b.m_Index, a.m_Index );
+            } );
 
-                if( p == a.A )
-                {
-                    is.is_corner_our = true;
-                }
+    // Report the intersections in the same order as the all-pairs loops
+    std::sort( candidates.begin(), candidates.end() );
 
-                if( p == a.B )
-                {
-                    is.is_corner_our = true;
-                    is.index_our++;
-                }
+    int lastRejected = -1;
 
-                if( p == b.A )
-                {
-                    is.is_corner_their = true;
-                }
+    for( const auto& [ s1, s2 ] : candidates )
+    {
+        if( s1 == lastRejected )
+            continue;
 
-                if( p == b.B )
-                {
-                    is.is_corner_their = true;
-                    is.index_their++;
-                }
+        const SEG& a = CSegment( s1 );
 
-                addIntersection( aIp, PointCount(), is );
-            }
+        if( !overlapsOther( a ) )
+        {
+            lastRejected = s1;
+            continue;
         }
+
+        intersectSegments( a, aChain.CSegment( s2 ), s1, s2, PointCount(),
+                           aExcludeColinearAndTouching, aIp );
     }
 
     return aIp.size();
@@ -1733,51 +1867,91 @@ bool SHAPE_LINE_CHAIN::CheckClearance( const VECTOR2I& aP, const int aDist ) con
 }
 
 
-const std::optional<SHAPE_LINE_CHAIN::INTERSECTION> SHAPE_LINE_CHAIN::SelfIntersecting() const
+std::optional<SHAPE_LINE_CHAIN::INTERSECTION>
+SHAPE_LINE_CHAIN::selfIntersection( int s1, int s2 ) const
 {
-    for( int s1 = 0; s1 < SegmentCount(); s1++ )
+    const SEG      seg1 = CSegment( s1 );
+    const VECTOR2I s2a = CSegment( s2 ).A, s2b = CSegment( s2 ).B;
+
+    if( s1 + 1 != s2 && seg1.Contains( s2a ) )
+    {
+        INTERSECTION is;
+        is.index_our = s1;
+        is.index_their = s2;
+        is.p = s2a;
+        return is;
+    }
+    else if( seg1.Contains( s2b ) &&
+             // for closed polylines, the ending point of the
+             // last segment == starting point of the first segment
+             // this is a normal case, not self intersecting case
+             !( IsClosed() && s1 == 0 && s2 == SegmentCount()-1 ) )
     {
-        for( int s2 = s1 + 1; s2 < SegmentCount(); s2++ )
+        INTERSECTION is;
+        is.index_our = s1;
+        is.index_their = s2;
+        is.p = s2b;
+        return is;
+    }
+    else
+    {
+        OPT_VECTOR2I p = seg1.Intersect( CSegment( s2 ), true );
+
+        if( p )
         {
-            const VECTOR2I s2a = CSegment( s2 ).A, s2b = CSegment( s2 ).B;
+            INTERSECTION is;
+            is.index_our = s1;
+            is.index_their = s2;
+            is.p = *p;
+            return is;
+        }
+    }
 
-            if( s1 + 1 != s2 && CSegment( s1 ).Contains( s2a ) )
-            {
-                INTERSECTION is;
-                is.index_our = s1;
-                is.index_their = s2;
-                is.p = s2a;
-                return is;
-            }
-            else if( CSegment( s1 ).Contains( s2b ) &&
-                     // for closed polylines, the ending point of the
-                     // last segment == starting point of the first segment
-                     // this is a normal case, not self intersecting case
-                     !( IsClosed() && s1 == 0 && s2 == SegmentCount()-1 ) )
+    return std::optional<SHAPE_LINE_CHAIN::INTERSECTION>();
+}
+
+
+const std::optional<SHAPE_LINE_CHAIN::INTERSECTION> SHAPE_LINE_CHAIN::SelfIntersecting() const
+{
+    if( SegmentCount() < SWEEP_MIN_SEGMENTS )
+    {
+        for( int s1 = 0; s1 < SegmentCount(); s1++ )
+        {
+            for( int s2 = s1 + 1; s2 < SegmentCount(); s2++ )
             {
-                INTERSECTION is;
-                is.index_our = s1;
-                is.index_their = s2;
-                is.p = s2b;
-                return is;
+                if( std::optional<INTERSECTION> is = selfIntersection( s1, s2 ) )
+                    return is;
             }
-            else
+        }
+
+        return std::optional<SHAPE_LINE_CHAIN::INTERSECTION>();
+    }
+
+    std::vector<SWEEP_SEGMENT>   segments;
+    std::optional<INTERSECTION>  first;
+
+    segments.reserve( SegmentCount() );
+    addSweepSegments( *this, true, segments );
+
+    // SEG::Contains() accepts points up to 1 unit away from the segment
+    sweepSegmentPairs( segments, 1,
+            [&]( const SWEEP_SEGMENT& a, const SWEEP_SEGMENT& b )
             {
-                OPT_VECTOR2I p = CSegment( s1 ).Intersect( CSegment( s2 ), true );
+                int s1 = std::min( a.m_Index, b.m_Index );
+                int s2 = std::max( a.m_Index, b.m_Index );
 
-                if( p )
+                // Keep the intersection the all-pairs loops would have found first
+                if( first && std::make_pair( s1, s2 )
+                                     >= std::make_pair( first->index_our, first->index_their ) )
                 {
-                    INTERSECTION is;
-                    is.index_our = s1;
-                    is.index_their = s2;
-                    is.p = *p;
-                    return is;
+                    return;
                 }
-            }
-        }
-    }
 
-    return std::optional<SHAPE_LINE_CHAIN::INTERSECTION>();
+                if( std::optional<INTERSECTION> is = selfIntersection( s1, s2 ) )
+                    first = is;
+            } );
+
+    return first;
 }
 
 
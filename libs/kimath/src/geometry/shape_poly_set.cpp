@@ -32,18 +32,22 @@
 #include <assert.h>                          // for assert
 #include <cmath>                             // for sqrt, cos, hypot, isinf
 #include <cstdio>
+#include <functional>
 #include <istream>                           // for operator<<, operator>>
 #include <limits>                            // for numeric_limits
 #include <map>
 #include <memory>
 #include <set>
 #include <string>                            // for char_traits, operator!=
+#include <tuple>
 #include <type_traits>                       // for swap, move
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include <clipper.hpp>                       // for Clipper, PolyNode, Clipp...
 #include <clipper2/clipper.h>
+#include <core/thread_pool.h>
 #include <geometry/geometry_utils.h>
 #include <geometry/polygon_triangulation.h>
 #include <geometry/seg.h>                    // for SEG, OPT_VECTOR2I
@@ -230,6 +234,8 @@ bool SHAPE_POLY_SET::GetGlobalIndex( SHAPE_POLY_SET::VERTEX_INDEX aRelativeIndic
 
 int SHAPE_POLY_SET::NewOutline()
 {
+    ClearEdgeIndex();
+
     SHAPE_LINE_CHAIN empty_path;
     POLYGON poly;
 
@@ -242,6 +248,8 @@ int SHAPE_POLY_SET::NewOutline()
 
 int SHAPE_POLY_SET::NewHole( int aOutline )
 {
+    ClearEdgeIndex();
+
     SHAPE_LINE_CHAIN empty_path;
 
     empty_path.SetClosed( true );
@@ -259,6 +267,8 @@ int SHAPE_POLY_SET::NewHole( int aOutline )
 
 int SHAPE_POLY_SET::Append( int x, int y, int aOutline, int aHole, bool aAllowDuplication )
 {
+    ClearEdgeIndex();
+
     assert( m_polys.size() );
 
     if( aOutline < 0 )
@@ -282,6 +292,8 @@ int SHAPE_POLY_SET::Append( int x, int y, int aOutline, int aHole, bool aAllowDu
 
 int SHAPE_POLY_SET::Append( const SHAPE_ARC& aArc, int aOutline, int aHole, double aAccuracy )
 {
+    ClearEdgeIndex();
+
     assert( m_polys.size() );
 
     if( aOutline < 0 )
@@ -305,6 +317,8 @@ int SHAPE_POLY_SET::Append( const SHAPE_ARC& aArc, int aOutline, int aHole, doub
 
 void SHAPE_POLY_SET::InsertVertex( int aGlobalIndex, const VECTOR2I& aNewVertex )
 {
+    ClearEdgeIndex();
+
     VERTEX_INDEX index;
 
     if( aGlobalIndex < 0 )
@@ -532,6 +546,8 @@ bool SHAPE_POLY_SET::IsSelfIntersecting() const
 
 int SHAPE_POLY_SET::AddOutline( const SHAPE_LINE_CHAIN& aOutline )
 {
+    ClearEdgeIndex();
+
     assert( aOutline.IsClosed() );
 
     POLYGON poly;
@@ -546,6 +562,8 @@ int SHAPE_POLY_SET::AddOutline( const SHAPE_LINE_CHAIN& aOutline )
 
 int SHAPE_POLY_SET::AddHole( const SHAPE_LINE_CHAIN& aHole, int aOutline )
 {
+    ClearEdgeIndex();
+
     assert( m_polys.size() );
 
     if( aOutline < 0 )
@@ -565,6 +583,8 @@ int SHAPE_POLY_SET::AddHole( const SHAPE_LINE_CHAIN& aHole, int aOutline )
 
 int SHAPE_POLY_SET::AddPolygon( const POLYGON& apolygon )
 {
+    ClearEdgeIndex();
+
     m_polys.push_back( apolygon );
 
     return m_polys.size() - 1;
@@ -616,6 +636,8 @@ void SHAPE_POLY_SET::GetArcs( std::vector<SHAPE_ARC>& aArcBuffer ) const
 
 void SHAPE_POLY_SET::ClearArcs()
 {
+    ClearEdgeIndex();
+
     for( POLYGON& poly : m_polys )
     {
         for( size_t i = 0; i < poly.size(); i++ )
@@ -626,6 +648,8 @@ void SHAPE_POLY_SET::ClearArcs()
 
 void SHAPE_POLY_SET::RebuildHolesFromContours()
 {
+    ClearEdgeIndex();
+
     std::vector<SHAPE_LINE_CHAIN> contours;
 
     for( const POLYGON& poly : m_polys )
@@ -740,6 +764,8 @@ void SHAPE_POLY_SET::booleanOp( ClipperLib::ClipType aType, const SHAPE_POLY_SET
 void SHAPE_POLY_SET::booleanOp( ClipperLib::ClipType aType, const SHAPE_POLY_SET& aShape,
                                 const SHAPE_POLY_SET& aOtherShape, POLYGON_MODE aFastMode )
 {
+    ClearEdgeIndex();
+
     if( ( aShape.OutlineCount() > 1 || aOtherShape.OutlineCount() > 0 )
         && ( aShape.ArcCount() > 0 || aOtherShape.ArcCount() > 0 ) )
     {
@@ -842,66 +868,26 @@ void SHAPE_POLY_SET::booleanOp( ClipperLib::ClipType aType, const SHAPE_POLY_SET
 }
 
 
-void SHAPE_POLY_SET::booleanOp( Clipper2Lib::ClipType aType, const SHAPE_POLY_SET& aOtherShape )
-{
-    booleanOp( aType, *this, aOtherShape );
-}
-
-
-void SHAPE_POLY_SET::booleanOp( Clipper2Lib::ClipType aType, const SHAPE_POLY_SET& aShape,
-                                const SHAPE_POLY_SET& aOtherShape )
+/**
+ * Build the Clipper2 callback which tracks the arcs the intersection points of a boolean
+ * operation are on.
+ */
+static Clipper2Lib::ZCallback64 clipper2ZCallback( std::vector<CLIPPER_Z_VALUE>& aZValues )
 {
-    if( ( aShape.OutlineCount() > 1 || aOtherShape.OutlineCount() > 0 )
-        && ( aShape.ArcCount() > 0 || aOtherShape.ArcCount() > 0 ) )
-    {
-        wxFAIL_MSG( wxT( "Boolean ops on curved polygons are not supported. You should call "
-                         "ClearArcs() before carrying out the boolean operation." ) );
-    }
-
-    Clipper2Lib::Clipper64 c;
-
-    std::vector<CLIPPER_Z_VALUE> zValues;
-    std::vector<SHAPE_ARC> arcBuffer;
-    std::map<VECTOR2I, CLIPPER_Z_VALUE> newIntersectPoints;
-
-    Clipper2Lib::Paths64 paths;
-    Clipper2Lib::Paths64 clips;
-
-    for( const POLYGON& poly : aShape.m_polys )
-    {
-        for( size_t i = 0; i < poly.size(); i++ )
-        {
-            paths.push_back( poly[i].convertToClipper2( i == 0, zValues, arcBuffer ) );
-        }
-    }
-
-    for( const POLYGON& poly : aOtherShape.m_polys )
-    {
-        for( size_t i = 0; i < poly.size(); i++ )
-        {
-            clips.push_back( poly[i].convertToClipper2( i == 0, zValues, arcBuffer ) );
-        }
-    }
-
-    c.AddSubject( paths );
-    c.AddClip( clips );
-
-    Clipper2Lib::PolyTree64 solution;
-
-    Clipper2Lib::ZCallback64 callback =
-            [&]( const Clipper2Lib::Point64 & e1bot, const Clipper2Lib::Point64 & e1top,
-                 const Clipper2Lib::Point64 & e2bot, const Clipper2Lib::Point64 & e2top,
-                 Clipper2Lib::Point64 & pt )
+    return
+            [&aZValues]( const Clipper2Lib::Point64 & e1bot, const Clipper2Lib::Point64 & e1top,
+                         const Clipper2Lib::Point64 & e2bot, const Clipper2Lib::Point64 & e2top,
+                         Clipper2Lib::Point64 & pt )
             {
                 auto arcIndex =
                     [&]( const ssize_t& aZvalue, const ssize_t& aCompareVal = -1 ) -> ssize_t
                     {
                         ssize_t retval;
 
-                        retval = zValues.at( aZvalue ).m_SecondArcIdx;
+                        retval = aZValues.at( aZvalue ).m_SecondArcIdx;
 
                         if( retval == -1 || ( aCompareVal > 0 && retval != aCompareVal ) )
-                            retval = zValues.at( aZvalue ).m_FirstArcIdx;
+                            retval = aZValues.at( aZvalue ).m_FirstArcIdx;
 
                         return retval;
                     };
@@ -936,18 +922,63 @@ void SHAPE_POLY_SET::booleanOp( Clipper2Lib::ClipType aType, const SHAPE_POLY_SE
                     newZval.m_SecondArcIdx = -1;
                 }
 
-                size_t z_value_ptr = zValues.size();
-                zValues.push_back( newZval );
-
-                // Only worry about arc segments for later processing
-                if( newZval.m_FirstArcIdx != -1 )
-                    newIntersectPoints.insert( { VECTOR2I( pt.x, pt.y ), newZval } );
+                size_t z_value_ptr = aZValues.size();
+                aZValues.push_back( newZval );
 
                 pt.z = z_value_ptr;
                 //@todo amend X,Y values to true intersection between arcs or arc and segment
             };
+}
+
+
+void SHAPE_POLY_SET::booleanOp( Clipper2Lib::ClipType aType, const SHAPE_POLY_SET& aOtherShape )
+{
+    booleanOp( aType, *this, aOtherShape );
+}
+
+
+void SHAPE_POLY_SET::booleanOp( Clipper2Lib::ClipType aType, const SHAPE_POLY_SET& aShape,
+                                const SHAPE_POLY_SET& aOtherShape )
+{
+    ClearEdgeIndex();
+
+    if( ( aShape.OutlineCount() > 1 || aOtherShape.OutlineCount() > 0 )
+        && ( aShape.ArcCount() > 0 || aOtherShape.ArcCount() > 0 ) )
+    {
+        wxFAIL_MSG( wxT( "Boolean ops on curved polygons are not supported. You should call "
+                         "ClearArcs() before carrying out the boolean operation." ) );
+    }
+
+    Clipper2Lib::Clipper64 c;
 
-    c.SetZCallback( std::move( callback ) ); // register callback
+    std::vector<CLIPPER_Z_VALUE> zValues;
+    std::vector<SHAPE_ARC> arcBuffer;
+
+    Clipper2Lib::Paths64 paths;
+    Clipper2Lib::Paths64 clips;
+
+    for( const POLYGON& poly : aShape.m_polys )
+    {
+        for( size_t i = 0; i < poly.size(); i++ )
+        {
+            paths.push_back( poly[i].convertToClipper2( i == 0, zValues, arcBuffer ) );
+        }
+    }
+
+    for( const POLYGON& poly : aOtherShape.m_polys )
+    {
+        for( size_t i = 0; i < poly.size(); i++ )
+        {
+            clips.push_back( poly[i].convertToClipper2( i == 0, zValues, arcBuffer ) );
+        }
+    }
+
+    c.AddSubject( paths );
+    c.AddClip( clips );
+
+    Clipper2Lib::PolyTree64 solution;
+
+    c.SetZCallback( clipper2ZCallback( zValues ) );
 
     c.Execute( aType, Clipper2Lib::FillRule::NonZero, solution );
 
@@ -1032,6 +1063,151 @@ void SHAPE_POLY_SET::BooleanXor( const SHAPE_POLY_SET& a, const SHAPE_POLY_SET&
 }
 
 
+SHAPE_POLY_SET::BOOLEAN_SESSION::BOOLEAN_SESSION( const SHAPE_POLY_SET& aSubject,
+                                                  POLYGON_MODE aFastMode ) :
+        m_source( &aSubject ),
+        m_mode( aFastMode ),
+        m_started( false ),
+        m_pendingType( Clipper2Lib::ClipType::None ),
+        m_pending( false )
+{
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::start()
+{
+    if( m_started )
+        return;
+
+    if( ADVANCED_CFG::GetCfg().m_UseClipper2 )
+        appendPaths( *m_source, m_subject );
+    else
+        m_legacy = std::make_unique<SHAPE_POLY_SET>( m_source->CloneDropTriangulation() );
+
+    m_started = true;
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::Add( const SHAPE_POLY_SET& aOther )
+{
+    start();
+
+    if( m_legacy )
+        m_legacy->BooleanAdd( aOther, m_mode );
+    else
+        addOperand( Clipper2Lib::ClipType::Union, aOther );
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::Subtract( const SHAPE_POLY_SET& aOther )
+{
+    start();
+
+    if( m_legacy )
+        m_legacy->BooleanSubtract( aOther, m_mode );
+    else
+        addOperand( Clipper2Lib::ClipType::Difference, aOther );
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::Intersect( const SHAPE_POLY_SET& aOther )
+{
+    start();
+
+    if( m_legacy )
+        m_legacy->BooleanIntersection( aOther, m_mode );
+    else
+        addOperand( Clipper2Lib::ClipType::Intersection, aOther );
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::Finish( SHAPE_POLY_SET& aResult )
+{
+    // Nothing to do: don't pay for a boolean which would only rewrite the geometry
+    if( !m_started )
+    {
+        if( &aResult != m_source )
+            aResult = *m_source;
+
+        return;
+    }
+
+    if( m_legacy )
+    {
+        aResult = *m_legacy;
+        return;
+    }
+
+    Clipper2Lib::PolyTree64 solution;
+
+    execute( nullptr, &solution );
+
+    aResult.ClearEdgeIndex();
+    aResult.importTree( solution, m_zValues, m_arcBuffer );
+    solution.Clear(); // Free used memory (not done in dtor)
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::addOperand( Clipper2Lib::ClipType aType,
+                                                  const SHAPE_POLY_SET& aOther )
+{
+    // With the non-zero fill rule, a union (or difference) with several clips is the union
+    // (or difference) with all of them, so consecutive ones are carried out together.  This
+    // does not hold for intersections.
+    if( m_pending
+            && ( aType != m_pendingType || aType == Clipper2Lib::ClipType::Intersection ) )
+    {
+        execute( &m_subject, nullptr );
+    }
+
+    appendPaths( aOther, m_clips );
+    m_pendingType = aType;
+    m_pending = true;
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::appendPaths( const SHAPE_POLY_SET& aSet,
+                                                   Clipper2Lib::Paths64& aPaths )
+{
+    if( aSet.ArcCount() > 0 )
+    {
+        wxFAIL_MSG( wxT( "Boolean ops on curved polygons are not supported. You should call "
+                         "ClearArcs() before carrying out the boolean operation." ) );
+    }
+
+    for( const POLYGON& poly : aSet.m_polys )
+    {
+        for( size_t i = 0; i < poly.size(); i++ )
+            aPaths.push_back( poly[i].convertToClipper2( i == 0, m_zValues, m_arcBuffer ) );
+    }
+}
+
+
+void SHAPE_POLY_SET::BOOLEAN_SESSION::execute( Clipper2Lib::Paths64*    aPaths,
+                                               Clipper2Lib::PolyTree64* aTree )
+{
+    Clipper2Lib::Clipper64 c;
+    Clipper2Lib::ClipType  type = Clipper2Lib::ClipType::Union;
+
+    c.SetZCallback( clipper2ZCallback( m_zValues ) );
+    c.AddSubject( m_subject );
+
+    if( m_pending )
+    {
+        c.AddClip( m_clips );
+        type = m_pendingType;
+    }
+
+    if( aTree )
+        c.Execute( type, Clipper2Lib::FillRule::NonZero, *aTree );
+    else
+        c.Execute( type, Clipper2Lib::FillRule::NonZero, *aPaths );
+
+    m_clips.clear();
+    m_pending = false;
+}
+
+
 void SHAPE_POLY_SET::InflateWithLinkedHoles( int aFactor, CORNER_STRATEGY aCornerStrategy,
                                              int aMaxError, POLYGON_MODE aFastMode )
 {
@@ -1336,6 +1512,8 @@ void SHAPE_POLY_SET::inflateLine2( const SHAPE_LINE_CHAIN& aLine, int aAmount, i
 void SHAPE_POLY_SET::Inflate( int aAmount, CORNER_STRATEGY aCornerStrategy, int aMaxError,
                               bool aSimplify )
 {
+    ClearEdgeIndex();
+
     int segCount = GetArcToSegmentCount( std::abs( aAmount ), aMaxError, FULL_CIRCLE );
 
     if( ADVANCED_CFG::GetCfg().m_UseClipper2 )
@@ -1348,6 +1526,8 @@ void SHAPE_POLY_SET::Inflate( int aAmount, CORNER_STRATEGY aCornerStrategy, int
 void SHAPE_POLY_SET::OffsetLineChain( const SHAPE_LINE_CHAIN& aLine, int aAmount,
                                   CORNER_STRATEGY aCornerStrategy, int aMaxError, bool aSimplify )
 {
+    ClearEdgeIndex();
+
     int segCount = GetArcToSegmentCount( std::abs( aAmount ), aMaxError, FULL_CIRCLE );
 
     inflateLine2( aLine, aAmount, segCount, aCornerStrategy, aSimplify );
@@ -1665,6 +1845,8 @@ void SHAPE_POLY_SET::fractureSingle( POLYGON& paths )
 
 void SHAPE_POLY_SET::Fracture( POLYGON_MODE aFastMode )
 {
+    ClearEdgeIndex();
+
     Simplify( aFastMode );    // remove overlapping holes/degeneracy
 
     for( POLYGON& paths : m_polys )
@@ -1856,6 +2038,8 @@ bool SHAPE_POLY_SET::HasHoles() const
 
 void SHAPE_POLY_SET::Unfracture( POLYGON_MODE aFastMode )
 {
+    ClearEdgeIndex();
+
     for( POLYGON& path : m_polys )
         unfractureSingle( path );
 
@@ -1876,6 +2060,8 @@ void SHAPE_POLY_SET::Simplify( POLYGON_MODE aFastMode )
 
 int SHAPE_POLY_SET::NormalizeAreaOutlines()
 {
+    ClearEdgeIndex();
+
     // We are expecting only one main outline, but this main outline can have holes
     // if holes: combine holes and remove them from the main outline.
     // Note also we are using SHAPE_POLY_SET::PM_STRICTLY_SIMPLE in polygon
@@ -1942,6 +2128,8 @@ const std::string SHAPE_POLY_SET::Format( bool aCplusPlus ) const
 
 bool SHAPE_POLY_SET::Parse( std::stringstream& aStream )
 {
+    ClearEdgeIndex();
+
     std::string tmp;
 
     aStream >> tmp;
@@ -2179,12 +2367,16 @@ bool SHAPE_POLY_SET::Collide( const SHAPE* aShape, int aClearance, int* aActual,
 
 void SHAPE_POLY_SET::RemoveAllContours()
 {
+    ClearEdgeIndex();
+
     m_polys.clear();
 }
 
 
 void SHAPE_POLY_SET::RemoveContour( int aContourIdx, int aPolygonIdx )
 {
+    ClearEdgeIndex();
+
     // Default polygon is the last one
     if( aPolygonIdx < 0 )
         aPolygonIdx += m_polys.size();
@@ -2195,6 +2387,8 @@ void SHAPE_POLY_SET::RemoveContour( int aContourIdx, int aPolygonIdx )
 
 int SHAPE_POLY_SET::RemoveNullSegments()
 {
+    ClearEdgeIndex();
+
     int removed = 0;
 
     ITERATOR iterator = IterateWithHoles();
@@ -2254,12 +2448,16 @@ int SHAPE_POLY_SET::RemoveNullSegments()
 
 void SHAPE_POLY_SET::DeletePolygon( int aIdx )
 {
+    ClearEdgeIndex();
+
     m_polys.erase( m_polys.begin() + aIdx );
 }
 
 
 void SHAPE_POLY_SET::DeletePolygonAndTriangulationData( int aIdx, bool aUpdateHash )
 {
+    ClearEdgeIndex();
+
     m_polys.erase( m_polys.begin() + aIdx );
 
     if( m_triangulationValid )
@@ -2288,6 +2486,8 @@ void SHAPE_POLY_SET::UpdateTriangulationDataHash()
 
 void SHAPE_POLY_SET::Append( const SHAPE_POLY_SET& aSet )
 {
+    ClearEdgeIndex();
+
     m_polys.insert( m_polys.end(), aSet.m_polys.begin(), aSet.m_polys.end() );
 }
 
@@ -2383,6 +2583,334 @@ void SHAPE_POLY_SET::BuildBBoxCaches() const
 }
 
 
+/// Contours with fewer points than this are not indexed: walking all their edges is about as
+/// fast as looking them up.
+static const int EDGE_INDEX_MIN_POINTS = 64;
+
+
+/**
+ * The edges of a closed contour, bucketed in horizontal slabs.
+ *
+ * An edge is listed in every slab its y range overlaps.  So all the edges crossed by a
+ * horizontal ray are in the slab of the ray, and the edges near a point are in the slabs near
+ * that point.
+ */
+class CONTOUR_EDGE_INDEX
+{
+public:
+    CONTOUR_EDGE_INDEX( const SHAPE_LINE_CHAIN& aContour )
+    {
+        const std::vector<VECTOR2I>& pts = aContour.CPoints();
+        const int                    n = pts.size();
+
+        int minY = std::numeric_limits<int>::max();
+        int maxY = std::numeric_limits<int>::min();
+
+        for( const VECTOR2I& pt : pts )
+        {
+            minY = std::min( minY, pt.y );
+            maxY = std::max( maxY, pt.y );
+        }
+
+        m_top = minY;
+
+        const int64_t span = (int64_t) maxY - minY + 1;
+        int64_t       slabs = std::max( 1, n / 8 );
+
+        // Long edges are listed in many slabs; use fewer, taller slabs when that gets out of hand
+        for( ;; )
+        {
+            m_slabHeight = std::max<int64_t>( 1, ( span + slabs - 1 ) / slabs );
+            m_slabCount = ( span + m_slabHeight - 1 ) / m_slabHeight;
+
+            int64_t entries = 0;
+
+            for( int ii = 0; ii < n; ii++ )
+            {
+                auto [ first, last ] = edgeSlabs( pts, ii );
+                entries += last - first + 1;
+            }
+
+            if( entries <= 8 * (int64_t) n || slabs == 1 )
+                break;
+
+            slabs = std::max<int64_t>( 1, slabs / 4 );
+        }
+
+        m_slabStart.assign( m_slabCount + 1, 0 );
+
+        for( int ii = 0; ii < n; ii++ )
+        {
+            auto [ first, last ] = edgeSlabs( pts, ii );
+
+            for( int k = first; k <= last; k++ )
+                m_slabStart[k + 1]++;
+        }
+
+        for( int k = 0; k < m_slabCount; k++ )
+            m_slabStart[k + 1] += m_slabStart[k];
+
+        std::vector<int> cursor( m_slabStart.begin(), m_slabStart.end() - 1 );
+
+        m_edges.resize( m_slabStart.back() );
+
+        for( int ii = 0; ii < n; ii++ )
+        {
+            auto [ first, last ] = edgeSlabs( pts, ii );
+
+            for( int k = first; k <= last; k++ )
+                m_edges[cursor[k]++] = ii;
+        }
+    }
+
+    void Move( const VECTOR2I& aVector ) { m_top += aVector.y; }
+
+    /**
+     * Same as SHAPE_LINE_CHAIN_BASE::PointInside(), without the bounding box test.
+     */
+    bool PointInside( const SHAPE_LINE_CHAIN& aContour, const VECTOR2I& aPt,
+                      int aAccuracy ) const
+    {
+        const std::vector<VECTOR2I>& pts = aContour.CPoints();
+        const int                    n = pts.size();
+        bool                         inside = false;
+
+        if( aPt.y >= m_top && (int64_t) aPt.y - m_top < (int64_t) m_slabCount * m_slabHeight )
+        {
+            int k = slabOf( aPt.y );
+
+            for( int ii = m_slabStart[k]; ii < m_slabStart[k + 1]; ii++ )
+            {
+                const VECTOR2I& p1 = pts[m_edges[ii]];
+                const VECTOR2I& p2 = pts[m_edges[ii] + 1 == n ? 0 : m_edges[ii] + 1];
+                const VECTOR2I  diff = p2 - p1;
+
+                if( diff.y != 0 && ( ( p1.y > aPt.y ) != ( p2.y > aPt.y ) ) )
+                {
+                    const int d = rescale( diff.x, ( aPt.y - p1.y ), diff.y );
+
+                    if( aPt.x - p1.x < d )
+                        inside = !inside;
+                }
+            }
+        }
+
+        if( aAccuracy <= 1 || inside )
+            return inside;
+
+        // Same as SHAPE_LINE_CHAIN_BASE::PointOnEdge()
+        bool onEdge = false;
+
+        visitSlabs( (int64_t) aPt.y - aAccuracy - 1, (int64_t) aPt.y + aAccuracy + 1,
+                [&]( int aEdge )
+                {
+                    const SEG s = aContour.CSegment( aEdge );
+
+                    if( s.A == aPt || s.B == aPt || s.Distance( aPt ) <= aAccuracy + 1 )
+                        onEdge = true;
+
+                    return !onEdge;
+                } );
+
+        return onEdge;
+    }
+
+    /**
+     * Find the edge with the smallest \a aDistance() to a query spanning \a aMinY to \a aMaxY.
+     *
+     * Ties are resolved in favour of the lowest edge index, as a walk through all the edges
+     * would.
+     *
+     * @return the squared distance to the edge, and the edge index (or -1).
+     */
+    template <typename Func>
+    std::pair<SEG::ecoord, int> Nearest( int aMinY, int aMaxY, Func&& aDistance ) const
+    {
+        SEG::ecoord best = VECTOR2I::ECOORD_MAX;
+        int         bestEdge = -1;
+
+        auto visit =
+                [&]( int k )
+                {
+                    for( int ii = m_slabStart[k]; ii < m_slabStart[k + 1] && best > 0; ii++ )
+                    {
+                        int         edge = m_edges[ii];
+                        SEG::ecoord dist = aDistance( edge );
+
+                        if( dist < best || ( dist == best && edge < bestEdge ) )
+                        {
+                            best = dist;
+                            bestEdge = edge;
+                        }
+                    }
+                };
+
+        // Squared distance from the query to slab k, in y only
+        auto slabDistance =
+                [&]( int k ) -> double
+                {
+                    int64_t slabMin = m_top + (int64_t) k * m_slabHeight;
+                    int64_t slabMax = slabMin + m_slabHeight - 1;
+                    double  gap = (double) std::max<int64_t>( { 0, slabMin - aMaxY,
+                                                                aMinY - slabMax } );
+                    return gap * gap;
+                };
+
+        int first = clampedSlabOf( aMinY );
+        int last = clampedSlabOf( aMaxY );
+
+        for( int k = first; k <= last; k++ )
+            visit( k );
+
+        // Then work outwards until the slabs are further away than the nearest edge
+        int below = first - 1;
+        int above = last + 1;
+
+        while( best > 0 && ( below >= 0 || above < m_slabCount ) )
+        {
+            if( below >= 0 )
+            {
+                if( slabDistance( below ) <= (double) best )
+                    visit( below-- );
+                else
+                    below = -1;
+            }
+
+            if( above < m_slabCount )
+            {
+                if( slabDistance( above ) <= (double) best )
+                    visit( above++ );
+                else
+                    above = m_slabCount;
+            }
+        }
+
+        return { best, bestEdge };
+    }
+
+private:
+    int slabOf( int64_t aY ) const { return ( aY - m_top ) / m_slabHeight; }
+
+    int clampedSlabOf( int64_t aY ) const
+    {
+        return std::clamp<int64_t>( ( aY - m_top ) / m_slabHeight, 0, m_slabCount - 1 );
+    }
+
+    std::pair<int, int> edgeSlabs( const std::vector<VECTOR2I>& aPts, int aEdge ) const
+    {
+        const VECTOR2I& p1 = aPts[aEdge];
+        const VECTOR2I& p2 = aPts[aEdge + 1 == (int) aPts.size() ? 0 : aEdge + 1];
+
+        return { slabOf( std::min( p1.y, p2.y ) ), slabOf( std::max( p1.y, p2.y ) ) };
+    }
+
+    /**
+     * Call \a aFunc for the edges of the slabs overlapping \a aMinY to \a aMaxY, until it
+     * returns false.  Edges spanning several slabs may be visited more than once.
+     */
+    template <typename Func>
+    void visitSlabs( int64_t aMinY, int64_t aMaxY, Func&& aFunc ) const
+    {
+        if( aMaxY < m_top || aMinY - m_top >= (int64_t) m_slabCount * m_slabHeight )
+            return;
+
+        for( int k = clampedSlabOf( aMinY ); k <= clampedSlabOf( aMaxY ); k++ )
+        {
+            for( int ii = m_slabStart[k]; ii < m_slabStart[k + 1]; ii++ )
+            {
+                if( !aFunc( m_edges[ii] ) )
+                    return;
+            }
+        }
+    }
+
+    int64_t          m_top;          ///< Lowest y of the contour
+    int64_t          m_slabHeight;
+    int              m_slabCount;
+    std::vector<int> m_slabStart;    ///< Offset of each slab in m_edges, plus the end offset
+    std::vector<int> m_edges;        ///< Edge indices, slab by slab
+};
+
+
+struct SHAPE_POLY_SET::EDGE_INDEX
+{
+    /// The index of each contour of each polygon, or null if it is too small to be indexed
+    std::vector<std::vector<std::unique_ptr<CONTOUR_EDGE_INDEX>>> m_Contours;
+
+    const CONTOUR_EDGE_INDEX* Get( int aPolygon, int aContour ) const
+    {
+        if( aPolygon < (int) m_Contours.size() && aContour < (int) m_Contours[aPolygon].size() )
+            return m_Contours[aPolygon][aContour].get();
+
+        return nullptr;
+    }
+
+    void Move( const VECTOR2I& aVector )
+    {
+        for( std::vector<std::unique_ptr<CONTOUR_EDGE_INDEX>>& polygon : m_Contours )
+        {
+            for( std::unique_ptr<CONTOUR_EDGE_INDEX>& contour : polygon )
+            {
+                if( contour )
+                    contour->Move( aVector );
+            }
+        }
+    }
+};
+
+
+void SHAPE_POLY_SET::BuildEdgeIndex() const
+{
+    // Still valid: every change to the geometry drops it
+    if( m_edgeIndex )
+        return;
+
+    m_edgeIndex = std::make_unique<EDGE_INDEX>();
+    m_edgeIndex->m_Contours.resize( m_polys.size() );
+
+    for( size_t polygonIdx = 0; polygonIdx < m_polys.size(); polygonIdx++ )
+    {
+        const POLYGON& polygon = m_polys[polygonIdx];
+
+        m_edgeIndex->m_Contours[polygonIdx].resize( polygon.size() );
+
+        for( size_t contourIdx = 0; contourIdx < polygon.size(); contourIdx++ )
+        {
+            const SHAPE_LINE_CHAIN& contour = polygon[contourIdx];
+
+            if( contour.IsClosed() && contour.PointCount() >= EDGE_INDEX_MIN_POINTS )
+            {
+                m_edgeIndex->m_Contours[polygonIdx][contourIdx] =
+                        std::make_unique<CONTOUR_EDGE_INDEX>( contour );
+            }
+        }
+    }
+}
+
+
+void SHAPE_POLY_SET::ClearEdgeIndex() const
+{
+    if( m_edgeIndex )
+        m_edgeIndex.reset();
+}
+
+
+bool SHAPE_POLY_SET::pointInsideContour( int aPoly, int aContour, const VECTOR2I& aPt,
+                                         int aAccuracy, bool aUseBBoxCache ) const
+{
+    const SHAPE_LINE_CHAIN&   contour = m_polys[aPoly][aContour];
+    const CONTOUR_EDGE_INDEX* index = m_edgeIndex ? m_edgeIndex->Get( aPoly, aContour ) : nullptr;
+
+    if( !index )
+        return contour.PointInside( aPt, aAccuracy, aUseBBoxCache );
+
+    if( aUseBBoxCache && !contour.GetCachedBBox()->Contains( aPt ) )
+        return false;
+
+    return index->PointInside( contour, aPt, aAccuracy );
+}
+
+
 bool SHAPE_POLY_SET::Contains( const VECTOR2I& aP, int aSubpolyIndex, int aAccuracy,
                                bool aUseBBoxCaches ) const
 {
@@ -2418,6 +2946,8 @@ void SHAPE_POLY_SET::RemoveVertex( int aGlobalIndex )
 
 void SHAPE_POLY_SET::RemoveVertex( VERTEX_INDEX aIndex )
 {
+    ClearEdgeIndex();
+
     m_polys[aIndex.m_polygon][aIndex.m_contour].Remove( aIndex.m_vertex );
 }
 
@@ -2435,6 +2965,8 @@ void SHAPE_POLY_SET::SetVertex( int aGlobalIndex, const VECTOR2I& aPos )
 
 void SHAPE_POLY_SET::SetVertex( const VERTEX_INDEX& aIndex, const VECTOR2I& aPos )
 {
+    ClearEdgeIndex();
+
     m_polys[aIndex.m_polygon][aIndex.m_contour].SetPoint( aIndex.m_vertex, aPos );
 }
 
@@ -2443,16 +2975,14 @@ bool SHAPE_POLY_SET::containsSingle( const VECTOR2I& aP, int aSubpolyIndex, int
                                      bool aUseBBoxCaches ) const
 {
     // Check that the point is inside the outline
-    if( m_polys[aSubpolyIndex][0].PointInside( aP, aAccuracy ) )
+    if( pointInsideContour( aSubpolyIndex, 0, aP, aAccuracy, false ) )
     {
         // Check that the point is not in any of the holes
         for( int holeIdx = 0; holeIdx < HoleCount( aSubpolyIndex ); holeIdx++ )
         {
-            const SHAPE_LINE_CHAIN& hole = CHole( aSubpolyIndex, holeIdx );
-
             // If the point is inside a hole it is outside of the polygon.  Do not use aAccuracy
             // here as it's meaning would be inverted.
-            if( hole.PointInside( aP, 1, aUseBBoxCaches ) )
+            if( pointInsideContour( aSubpolyIndex, holeIdx + 1, aP, 1, aUseBBoxCaches ) )
                 return false;
         }
 
@@ -2474,12 +3004,17 @@ void SHAPE_POLY_SET::Move( const VECTOR2I& aVector )
     for( std::unique_ptr<TRIANGULATED_POLYGON>& tri : m_triangulatedPolys )
         tri->Move( aVector );
 
+    if( m_edgeIndex )
+        m_edgeIndex->Move( aVector );
+
     m_hash = checksum();
 }
 
 
 void SHAPE_POLY_SET::Mirror( bool aX, bool aY, const VECTOR2I& aRef )
 {
+    ClearEdgeIndex();
+
     for( POLYGON& poly : m_polys )
     {
         for( SHAPE_LINE_CHAIN& path : poly )
@@ -2493,6 +3028,8 @@ void SHAPE_POLY_SET::Mirror( bool aX, bool aY, const VECTOR2I& aRef )
 
 void SHAPE_POLY_SET::Rotate( const EDA_ANGLE& aAngle, const VECTOR2I& aCenter )
 {
+    ClearEdgeIndex();
+
     for( POLYGON& poly : m_polys )
     {
         for( SHAPE_LINE_CHAIN& path : poly )
@@ -2532,6 +3069,53 @@ SHAPE_POLY_SET::POLYGON SHAPE_POLY_SET::FilletPolygon( unsigned int aRadius, int
 }
 
 
+template <typename DIST_FUNC, typename NEAREST_FUNC>
+SEG::ecoord SHAPE_POLY_SET::nearestEdge( int aPolygonIndex, int aMinY, int aMaxY,
+                                         DIST_FUNC&& aDistance, NEAREST_FUNC&& aNearest ) const
+{
+    const POLYGON& polygon = m_polys[aPolygonIndex];
+    SEG::ecoord    minDistance = VECTOR2I::ECOORD_MAX;
+
+    for( int contourIdx = 0; contourIdx < (int) polygon.size() && minDistance > 0; contourIdx++ )
+    {
+        const SHAPE_LINE_CHAIN&   contour = polygon[contourIdx];
+        const CONTOUR_EDGE_INDEX* index = m_edgeIndex->Get( aPolygonIndex, contourIdx );
+        SEG::ecoord               dist = VECTOR2I::ECOORD_MAX;
+        int                       edge = -1;
+
+        if( index )
+        {
+            std::tie( dist, edge ) = index->Nearest( aMinY, aMaxY,
+                    [&]( int aEdge )
+                    {
+                        return aDistance( contour.CSegment( aEdge ) );
+                    } );
+        }
+        else
+        {
+            for( int ii = 0; ii < contour.SegmentCount() && dist > 0; ii++ )
+            {
+                SEG::ecoord d = aDistance( contour.CSegment( ii ) );
+
+                if( d < dist )
+                {
+                    dist = d;
+                    edge = ii;
+                }
+            }
+        }
+
+        if( edge >= 0 && dist < minDistance )
+        {
+            minDistance = dist;
+            aNearest( contour.CSegment( edge ) );
+        }
+    }
+
+    return minDistance;
+}
+
+
 SEG::ecoord SHAPE_POLY_SET::SquaredDistanceToPolygon( VECTOR2I aPoint, int aPolygonIndex,
                                                       VECTOR2I* aNearest ) const
 {
@@ -2547,6 +3131,20 @@ SEG::ecoord SHAPE_POLY_SET::SquaredDistanceToPolygon( VECTOR2I aPoint, int aPoly
         return 0;
     }
 
+    if( m_edgeIndex )
+    {
+        return nearestEdge( aPolygonIndex, aPoint.y, aPoint.y,
+                            [&]( const SEG& aEdge )
+                            {
+                                return aEdge.SquaredDistance( aPoint );
+                            },
+                            [&]( const SEG& aEdge )
+                            {
+                                if( aNearest )
+                                    *aNearest = aEdge.NearestPoint( aPoint );
+                            } );
+    }
+
     CONST_SEGMENT_ITERATOR iterator = CIterateSegmentsWithHoles( aPolygonIndex );
 
     SEG::ecoord minDistance = (*iterator).SquaredDistance( aPoint );
@@ -2581,6 +3179,24 @@ SEG::ecoord SHAPE_POLY_SET::SquaredDistanceToPolygon( const SEG& aSegment, int a
         return 0;
     }
 
+    if( m_edgeIndex )
+    {
+        SEG::ecoord minDistance =
+                nearestEdge( aPolygonIndex, std::min( aSegment.A.y, aSegment.B.y ),
+                             std::max( aSegment.A.y, aSegment.B.y ),
+                             [&]( const SEG& aEdge )
+                             {
+                                 return aEdge.SquaredDistance( aSegment );
+                             },
+                             [&]( const SEG& aEdge )
+                             {
+                                 if( aNearest )
+                                     *aNearest = aEdge.NearestPoint( aSegment );
+                             } );
+
+        return minDistance < 0 ? 0 : minDistance;
+    }
+
     CONST_SEGMENT_ITERATOR iterator = CIterateSegmentsWithHoles( aPolygonIndex );
     SEG::ecoord            minDistance = (*iterator).SquaredDistance( aSegment );
 
@@ -2874,6 +3490,9 @@ SHAPE_POLY_SET &SHAPE_POLY_SET::operator=( const SHAPE_POLY_SET& aOther )
     static_cast<SHAPE&>(*this) = aOther;
     m_polys = aOther.m_polys;
 
+    ClearEdgeIndex();
+    m_triangulationDonor.reset();
+
     m_triangulatedPolys.clear();
 
     for( unsigned i = 0; i < aOther.TriangulatedPolyCount(); i++ )
@@ -2912,6 +3531,10 @@ bool SHAPE_POLY_SET::IsTriangulationUpToDate() const
 }
 
 
+///< Below this number of vertices, triangulation is not worth spreading over the thread pool
+static const int TRIANGULATION_MIN_PARALLEL_POINTS = 1000;
+
+
 static SHAPE_POLY_SET partitionPolyIntoRegularCellGrid( const SHAPE_POLY_SET& aPoly, int aSize )
 {
     BOX2I bb = aPoly.BBox();
@@ -2966,10 +3589,26 @@ static SHAPE_POLY_SET partitionPolyIntoRegularCellGrid( const SHAPE_POLY_SET& aP
         }
     }
 
-    ps1.BooleanIntersection( maskSetOdd, SHAPE_POLY_SET::PM_FAST );
-    ps2.BooleanIntersection( maskSetEven, SHAPE_POLY_SET::PM_FAST );
-    ps1.Fracture( SHAPE_POLY_SET::PM_FAST );
-    ps2.Fracture( SHAPE_POLY_SET::PM_FAST );
+    auto splitCells =
+            [&]( size_t aSet )
+            {
+                SHAPE_POLY_SET& ps = aSet ? ps2 : ps1;
+
+                ps.BooleanIntersection( aSet ? maskSetEven : maskSetOdd, SHAPE_POLY_SET::PM_FAST );
+                ps.Fracture( SHAPE_POLY_SET::PM_FAST );
+            };
+
+    // The odd and even cells are independent, and these are the slow parts of triangulating
+    // large polygons
+    if( aPoly.TotalVertices() >= TRIANGULATION_MIN_PARALLEL_POINTS )
+    {
+        RunOnThreadPool( 2, splitCells );
+    }
+    else
+    {
+        splitCells( 0 );
+        splitCells( 1 );
+    }
 
     for( int i = 0; i < ps2.OutlineCount(); i++ )
         ps1.AddOutline( ps2.COutline( i ) );
@@ -3002,7 +3641,10 @@ void SHAPE_POLY_SET::cacheTriangulation( bool aPartition, bool aSimplify,
     }
 
     if( !recalculate )
+    {
+        m_triangulationDonor.reset();
         return;
+    }
 
     auto triangulate =
             []( SHAPE_POLY_SET& polySet, int forOutline,
@@ -3052,33 +3694,138 @@ void SHAPE_POLY_SET::cacheTriangulation( bool aPartition, bool aSimplify,
                 return triangulationValid;
             };
 
+    // The previous triangulation, by the partition it was built from.  Partitions which did
+    // not change since then are not triangulated again.
+    std::vector<std::unique_ptr<TRIANGULATED_POLYGON>> previousPolys;
+    std::unordered_map<std::string, std::vector<const TRIANGULATED_POLYGON*>> previous;
+
+    std::shared_ptr<const SHAPE_POLY_SET> donor = std::move( m_triangulationDonor );
+
+    if( m_triangulationValid )
+        std::swap( previousPolys, m_triangulatedPolys );
+
+    auto addPrevious =
+            [&]( const std::unique_ptr<TRIANGULATED_POLYGON>& tpoly )
+            {
+                MD5_HASH sourceHash = tpoly->GetSourceHash();
+
+                if( sourceHash.IsValid() && tpoly->GetTriangleCount() > 0 )
+                    previous[ sourceHash.Format( true ) ].push_back( tpoly.get() );
+            };
+
+    for( const std::unique_ptr<TRIANGULATED_POLYGON>& tpoly : previousPolys )
+        addPrevious( tpoly );
+
+    if( donor && donor->m_triangulationValid )
+    {
+        for( const std::unique_ptr<TRIANGULATED_POLYGON>& tpoly : donor->m_triangulatedPolys )
+            addPrevious( tpoly );
+    }
+
     m_triangulatedPolys.clear();
     m_triangulationValid = true;
 
     if( aPartition )
     {
-        for( int ii = 0; ii < OutlineCount(); ++ii )
+        bool parallel = TotalVertices() >= TRIANGULATION_MIN_PARALLEL_POINTS;
+
+        auto forEach =
+                [&]( size_t aCount, const std::function<void( size_t )>& aFunction )
+                {
+                    if( parallel && aCount > 1 )
+                    {
+                        RunOnThreadPool( aCount, aFunction );
+                    }
+                    else
+                    {
+                        for( size_t ii = 0; ii < aCount; ++ii )
+                            aFunction( ii );
+                    }
+                };
+
+        std::vector<SHAPE_POLY_SET> partitions( OutlineCount() );
+
+        forEach( OutlineCount(),
+                [&]( size_t ii )
+                {
+                    // This partitions into regularly-sized grids (1cm in Pcbnew)
+                    SHAPE_POLY_SET flattened( COutline( ii ) );
+
+                    for( int jj = 0; jj < HoleCount( ii ); ++jj )
+                        flattened.AddHole( CHole( ii, jj ) );
+
+                    flattened.ClearArcs();
+
+                    if( flattened.HasHoles() || flattened.IsSelfIntersecting() )
+                        flattened.Fracture( PM_FAST );
+                    else if( aSimplify )
+                        flattened.Simplify( PM_FAST );
+
+                    partitions[ii] = partitionPolyIntoRegularCellGrid( flattened, 1e7 );
+                } );
+
+        // Every partition is triangulated on its own, in a slot of its own, so that the result
+        // does not depend on the order in which they complete.
+        struct PIECE
+        {
+            int sourceOutline;
+            int partition;
+            std::vector<std::unique_ptr<TRIANGULATED_POLYGON>> triangulation;
+        };
+
+        std::vector<PIECE> pieces;
+
+        for( int ii = 0; ii < (int) partitions.size(); ++ii )
         {
-            // This partitions into regularly-sized grids (1cm in Pcbnew)
-            SHAPE_POLY_SET flattened( Outline( ii ) );
+            for( int jj = 0; jj < partitions[ii].OutlineCount(); ++jj )
+                pieces.push_back( { ii, jj, {} } );
+        }
+
+        forEach( pieces.size(),
+                [&]( size_t aPiece )
+                {
+                    PIECE&          piece = pieces[aPiece];
+                    SHAPE_POLY_SET& partition = partitions[piece.sourceOutline];
+                    SHAPE_POLY_SET  pieceSet;
+
+                    pieceSet.AddPolygon( partition.CPolygon( piece.partition ) );
+
+                    MD5_HASH pieceHash = pieceSet.checksum();
+                    auto     it = previous.find( pieceHash.Format( true ) );
 
-            for( int jj = 0; jj < HoleCount( ii ); ++jj )
-                flattened.AddHole( Hole( ii, jj ) );
+                    if( it != previous.end() )
+                    {
+                        for( const TRIANGULATED_POLYGON* tpoly : it->second )
+                        {
+                            auto copy = std::make_unique<TRIANGULATED_POLYGON>( *tpoly );
 
-            flattened.ClearArcs();
+                            copy->SetSourceOutlineIndex( piece.sourceOutline );
+                            piece.triangulation.push_back( std::move( copy ) );
+                        }
 
-            if( flattened.HasHoles() || flattened.IsSelfIntersecting() )
-                flattened.Fracture( PM_FAST );
-            else if( aSimplify )
-                flattened.Simplify( PM_FAST );
+                        return;
+                    }
+
+                    // Hint data is only ever provided for unpartitioned triangulations
+                    int  outline = piece.sourceOutline;
+                    bool ok = triangulate( pieceSet, outline, piece.triangulation, nullptr );
+
+                    if( !ok )
+                    {
+                        wxLogTrace( TRIANGULATE_TRACE,
+                                    "Failed to triangulate partitioned polygon %d", outline );
+                    }
 
-            SHAPE_POLY_SET partitions = partitionPolyIntoRegularCellGrid( flattened, 1e7 );
+                    for( std::unique_ptr<TRIANGULATED_POLYGON>& tpoly : piece.triangulation )
+                        tpoly->SetSourceHash( pieceHash );
+                } );
 
-            // This pushes the triangulation for all polys in partitions
-            // to be referenced to the ii-th polygon
-            if( !triangulate( partitions, ii , m_triangulatedPolys, aHintData ) )
+        for( PIECE& piece : pieces )
+        {
+            for( std::unique_ptr<TRIANGULATED_POLYGON>& tpoly : piece.triangulation )
             {
-                wxLogTrace( TRIANGULATE_TRACE, "Failed to triangulate partitioned polygon %d", ii );
+                if( tpoly->GetTriangleCount() > 0 )
+                    m_triangulatedPolys.push_back( std::move( tpoly ) );
             }
         }
     }
@@ -3100,6 +3847,18 @@ void SHAPE_POLY_SET::cacheTriangulation( bool aPartition, bool aSimplify,
 }
 
 
+void SHAPE_POLY_SET::InheritTriangulation( std::shared_ptr<const SHAPE_POLY_SET> aPrevious )
+{
+    // Triangles are matched on the partition they were built from, so they need not be up to
+    // date with aPrevious.  Don't keep a chain of untriangulated sets alive though.
+    if( aPrevious && !aPrevious->m_triangulationValid )
+        aPrevious = aPrevious->m_triangulationDonor;
+
+    if( aPrevious.get() != this )
+        m_triangulationDonor = std::move( aPrevious );
+}
+
+
 MD5_HASH SHAPE_POLY_SET::checksum() const
 {
     MD5_HASH hash;
@@ -3212,6 +3971,7 @@ void SHAPE_POLY_SET::TRIANGULATED_POLYGON::AddTriangle( int a, int b, int c )
 SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRIANGULATED_POLYGON( const TRIANGULATED_POLYGON& aOther )
 {
     m_sourceOutline = aOther.m_sourceOutline;
+    m_sourceHash = aOther.m_sourceHash;
     m_vertices = aOther.m_vertices;
     m_triangles = aOther.m_triangles;
 
@@ -3223,6 +3983,7 @@ SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRIANGULATED_POLYGON( const TRIANGULATED_P
 SHAPE_POLY_SET::TRIANGULATED_POLYGON& SHAPE_POLY_SET::TRIANGULATED_POLYGON::operator=( const TRIANGULATED_POLYGON& aOther )
 {
     m_sourceOutline = aOther.m_sourceOutline;
+    m_sourceHash = aOther.m_sourceHash;
     m_vertices = aOther.m_vertices;
     m_triangles = aOther.m_triangles;
 
@@ -3300,7 +4061,7 @@ bool SHAPE_POLY_SET::PointInside( const VECTOR2I& aPt, int aAccuracy, bool aUseB
 {
     for( int idx = 0; idx < OutlineCount(); idx++ )
     {
-        if( COutline( idx ).PointInside( aPt, aAccuracy, aUseBBoxCache ) )
+        if( pointInsideContour( idx, 0, aPt, aAccuracy, aUseBBoxCache ) )
             return true;
     }
 
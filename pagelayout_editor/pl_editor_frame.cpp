@@ -944,11 +944,11 @@ void PL_EDITOR_FRAME::ClearUndoORRedoList( UNDO_REDO_LIST whichList, int aItemCo
     {
         for( int ii = 0; ii < aItemCount; ii++ )
         {
-            if( list.m_CommandsList.size() == 0 )
+            PICKED_ITEMS_LIST* curr_cmd = list.PopOldestCommand();
+
+            if( !curr_cmd )
                 break;
 
-            PICKED_ITEMS_LIST* curr_cmd = list.m_CommandsList[0];
-            list.m_CommandsList.erase( list.m_CommandsList.begin() );
 
             curr_cmd->ClearListAndDeleteItems( []( EDA_ITEM* aItem )
                                                {
@@ -26,6 +26,7 @@
  */
 
 #include <iterator>
+#include <unordered_set>
 
 #include <wx/log.h>
 
@@ -61,6 +62,7 @@
 #include <tool/tool_manager.h>
 #include <tool/selection_conditions.h>
 #include <string_utils.h>
+#include <trace_helpers.h>
 #include <core/thread_pool.h>
 #include <zone.h>
 
@@ -144,7 +146,11 @@ BOARD::~BOARD()
             item->SetParentGroup( nullptr );
     }
 
-    // Clean up the owned elements
+    // Clean up the owned elements.  The whole board goes, so there is no point keeping the
+    // KIID index up to date while deleting.
+    m_itemByIdCache.clear();
+    m_itemByIdCacheKeys.clear();
+
     DeleteMARKERs();
 
     for( ZONE* zone : m_zones )
@@ -941,6 +947,10 @@ void BOARD::Add( BOARD_ITEM* aBoardItem, ADD_MODE aMode, bool aSkipConnectivity
     aBoardItem->SetParent( this );
     aBoardItem->ClearEditFlags();
 
+    // Nets are looked up by GetItem() too, but they are owned (and deleted) by the net list
+    if( aBoardItem->Type() != PCB_NETINFO_T )
+        CacheItemById( aBoardItem );
+
     if( !aSkipConnectivity )
         m_connectivity->Add( aBoardItem );
 
@@ -1031,17 +1041,74 @@ void BOARD::Remove( BOARD_ITEM* aBoardItem, REMOVE_MODE aRemoveMode )
         wxFAIL_MSG( wxT( "BOARD::Remove() needs more ::Type() support" ) );
     }
 
+    detachRemovedItem( aBoardItem );
+
+    if( aRemoveMode != REMOVE_MODE::BULK )
+        InvokeListeners( &BOARD_LISTENER::OnBoardItemRemoved, *this, aBoardItem );
+}
+
+
+void BOARD::RemoveItems( const std::vector<BOARD_ITEM*>& aItems, REMOVE_MODE aRemoveMode )
+{
+    std::unordered_set<const BOARD_ITEM*> removed;
+
+    removed.reserve( aItems.size() );
+
+    for( BOARD_ITEM* item : aItems )
+    {
+        wxCHECK2( item, continue );
+
+        // Nets are not kept in the item lists; they are removed one by one as usual
+        if( item->Type() == PCB_NETINFO_T )
+            Remove( item, REMOVE_MODE::BULK );
+        else
+            removed.insert( item );
+    }
+
+    if( !removed.empty() )
+    {
+        auto isRemoved =
+                [&]( const BOARD_ITEM* aItem )
+                {
+                    return removed.count( aItem ) > 0;
+                };
+
+        // One pass over each list, whatever the number of removed items
+        alg::delete_if( m_tracks, isRemoved );
+        alg::delete_if( m_footprints, isRemoved );
+        alg::delete_if( m_drawings, isRemoved );
+        alg::delete_if( m_zones, isRemoved );
+        alg::delete_if( m_markers, isRemoved );
+        alg::delete_if( m_groups, isRemoved );
+        alg::delete_if( m_generators, isRemoved );
+
+        for( BOARD_ITEM* item : aItems )
+        {
+            if( item && item->Type() != PCB_NETINFO_T )
+                detachRemovedItem( item );
+        }
+    }
+
+    if( aRemoveMode != REMOVE_MODE::BULK )
+    {
+        std::vector<BOARD_ITEM*> removedItems( aItems );
+        FinalizeBulkRemove( removedItems );
+    }
+}
+
+
+void BOARD::detachRemovedItem( BOARD_ITEM* aBoardItem )
+{
     aBoardItem->SetFlags( STRUCT_DELETED );
 
+    UncacheItemById( aBoardItem );
+
     PCB_GROUP* parentGroup = aBoardItem->GetParentGroup();
 
     if( parentGroup && !( parentGroup->GetFlags() & STRUCT_DELETED ) )
         parentGroup->RemoveItem( aBoardItem );
 
     m_connectivity->Remove( aBoardItem );
-
-    if( aRemoveMode != REMOVE_MODE::BULK )
-        InvokeListeners( &BOARD_LISTENER::OnBoardItemRemoved, *this, aBoardItem );
 }
 
 
@@ -1081,7 +1148,10 @@ void BOARD::DeleteMARKERs()
 {
     // the vector does not know how to delete the PCB_MARKER, it holds pointers
     for( PCB_MARKER* marker : m_markers )
+    {
+        UncacheItemById( marker );
         delete marker;
+    }
 
     m_markers.clear();
 }
@@ -1097,6 +1167,7 @@ void BOARD::DeleteMARKERs( bool aWarningsAndErrors, bool aExclusions )
         if( ( marker->GetSeverity() == RPT_SEVERITY_EXCLUSION && aExclusions )
                 || ( marker->GetSeverity() != RPT_SEVERITY_EXCLUSION && aWarningsAndErrors ) )
         {
+            UncacheItemById( marker );
             delete marker;
         }
         else
@@ -1112,7 +1183,10 @@ void BOARD::DeleteMARKERs( bool aWarningsAndErrors, bool aExclusions )
 void BOARD::DeleteAllFootprints()
 {
     for( FOOTPRINT* footprint : m_footprints )
+    {
+        UncacheItemById( footprint );
         delete footprint;
+    }
 
     m_footprints.clear();
 }
@@ -1123,6 +1197,14 @@ BOARD_ITEM* BOARD::GetItem( const KIID& aID ) const
     if( aID == niluuid )
         return nullptr;
 
+    auto cached = m_itemByIdCache.find( aID );
+
+    // An item given a new KIID since it was indexed is still under its old KIID, so check it
+    if( cached != m_itemByIdCache.end() && cached->second->m_Uuid == aID )
+        return cached->second;
+
+    // Not indexed: nets, table cells (which resolve to their table) and items whose KIID was
+    // changed while on the board.  Fall back to searching the whole board.
     for( PCB_TRACK* track : Tracks() )
     {
         if( track->m_Uuid == aID )
@@ -1219,6 +1301,129 @@ BOARD_ITEM* BOARD::GetItem( const KIID& aID ) const
 }
 
 
+void BOARD::CacheItemById( BOARD_ITEM* aItem )
+{
+    auto cache =
+            [&]( BOARD_ITEM* aEntry )
+            {
+                auto key = m_itemByIdCacheKeys.find( aEntry );
+
+                if( key != m_itemByIdCacheKeys.end() )
+                {
+                    if( key->second == aEntry->m_Uuid )
+                    {
+                        m_itemByIdCache[ key->second ] = aEntry;
+                        return;
+                    }
+
+                    // Indexed before under another KIID
+                    auto entry = m_itemByIdCache.find( key->second );
+
+                    if( entry != m_itemByIdCache.end() && entry->second == aEntry )
+                        m_itemByIdCache.erase( entry );
+                }
+
+                m_itemByIdCache[ aEntry->m_Uuid ] = aEntry;
+                m_itemByIdCacheKeys[ aEntry ] = aEntry->m_Uuid;
+            };
+
+    cache( aItem );
+
+    if( aItem->Type() == PCB_FOOTPRINT_T )
+        static_cast<FOOTPRINT*>( aItem )->RunOnChildren( cache );
+}
+
+
+void BOARD::UncacheItemById( BOARD_ITEM* aItem )
+{
+    auto uncache =
+            [&]( BOARD_ITEM* aEntry )
+            {
+                auto key = m_itemByIdCacheKeys.find( aEntry );
+
+                if( key == m_itemByIdCacheKeys.end() )
+                    return;
+
+                auto entry = m_itemByIdCache.find( key->second );
+
+                // Another item may have been indexed under the same KIID since
+                if( entry != m_itemByIdCache.end() && entry->second == aEntry )
+                    m_itemByIdCache.erase( entry );
+
+                m_itemByIdCacheKeys.erase( key );
+            };
+
+    uncache( aItem );
+
+    if( aItem->Type() == PCB_FOOTPRINT_T )
+        static_cast<FOOTPRINT*>( aItem )->RunOnChildren( uncache );
+}
+
+
+bool BOARD::CheckItemByIdCache() const
+{
+    std::unordered_set<const BOARD_ITEM*> boardItems;
+    bool                                  valid = true;
+
+    auto check =
+            [&]( const BOARD_ITEM* aItem )
+            {
+                boardItems.insert( aItem );
+
+                if( !IsItemCachedById( aItem ) )
+                {
+                    wxLogTrace( traceFindItem, wxT( "Item %s is not in the KIID index" ),
+                                aItem->m_Uuid.AsString() );
+                    valid = false;
+                }
+            };
+
+    for( PCB_TRACK* track : m_tracks )
+        check( track );
+
+    for( FOOTPRINT* footprint : m_footprints )
+    {
+        check( footprint );
+        footprint->RunOnChildren( check );
+    }
+
+    for( ZONE* zone : m_zones )
+        check( zone );
+
+    for( BOARD_ITEM* drawing : m_drawings )
+        check( drawing );
+
+    for( PCB_MARKER* marker : m_markers )
+        check( marker );
+
+    for( PCB_GROUP* group : m_groups )
+        check( group );
+
+    for( PCB_GENERATOR* generator : m_generators )
+        check( generator );
+
+    for( const auto& [ id, item ] : m_itemByIdCache )
+    {
+        if( !boardItems.count( item ) )
+        {
+            wxLogTrace( traceFindItem, wxT( "KIID index entry %s is not on the board" ),
+                        id.AsString() );
+            valid = false;
+        }
+    }
+
+    // Every board item is indexed, so any extra key is left over from a deleted item
+    if( m_itemByIdCacheKeys.size() != boardItems.size() )
+    {
+        wxLogTrace( traceFindItem, wxT( "KIID index holds %d items, the board %d" ),
+                    (int) m_itemByIdCacheKeys.size(), (int) boardItems.size() );
+        valid = false;
+    }
+
+    return valid;
+}
+
+
 void BOARD::FillItemMap( std::map<KIID, EDA_ITEM*>& aMap )
 {
     // the board itself
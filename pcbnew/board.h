@@ -401,6 +401,19 @@ public:
      */
     void FinalizeBulkRemove( std::vector<BOARD_ITEM*>& aRemovedItems );
 
+    /**
+     * Remove several items at once.
+     *
+     * Does the same as calling Remove() for each item, but the item lists of the board are
+     * compacted in a single pass instead of being searched once per removed item.
+     *
+     * @param aMode when REMOVE_MODE::BULK, no change event is sent and FinalizeBulkRemove()
+     *              must be called afterwards.  Otherwise listeners get a single
+     *              OnBoardItemsRemoved() event for the whole batch.
+     */
+    void RemoveItems( const std::vector<BOARD_ITEM*>& aItems,
+                      REMOVE_MODE aMode = REMOVE_MODE::NORMAL );
+
     void CacheTriangulation( PROGRESS_REPORTER* aReporter = nullptr,
                              const std::vector<ZONE*>& aZones = {} );
 
@@ -426,6 +439,36 @@ public:
      */
     BOARD_ITEM* GetItem( const KIID& aID ) const;
 
+    /**
+     * Add \a aItem, and the items of a footprint, to the KIID index used by GetItem().
+     *
+     * Called by Add() for board items and by FOOTPRINT for the items of indexed footprints.
+     */
+    void CacheItemById( BOARD_ITEM* aItem );
+
+    /**
+     * Remove \a aItem, and the items of a footprint, from the KIID index used by GetItem().
+     *
+     * Must be called before an indexed item is deleted.
+     */
+    void UncacheItemById( BOARD_ITEM* aItem );
+
+    /**
+     * @return true if \a aItem is in the KIID index, i.e. it is owned by this board.
+     */
+    bool IsItemCachedById( const BOARD_ITEM* aItem ) const
+    {
+        return m_itemByIdCacheKeys.count( aItem ) > 0;
+    }
+
+    /**
+     * Check the KIID index against the items actually owned by the board.  This walks the whole
+     * board, so it is only run automatically in debug builds.
+     *
+     * @return true if every board item is indexed and every index entry is a board item.
+     */
+    bool CheckItemByIdCache() const;
+
     void FillItemMap( std::map<KIID, EDA_ITEM*>& aMap );
 
     /**
@@ -1260,6 +1303,12 @@ private:
             ( l->*aFunc )( std::forward<Args>( args )... );
     }
 
+    /**
+     * Finish the removal of \a aBoardItem, once it has been taken out of the board item
+     * lists: flag it, and drop it from its group, the KIID index and the connectivity data.
+     */
+    void detachRemovedItem( BOARD_ITEM* aBoardItem );
+
     friend class PCB_EDIT_FRAME;
 
 
@@ -1316,6 +1365,11 @@ private:
 
     NETINFO_LIST                 m_NetInfo;         // net info list (name, design constraints...
 
+    /// Index of the board items by KIID, see GetItem().  Items can be given a new KIID while on
+    /// the board, so the KIID each item was indexed under is also kept to remove it again.
+    std::unordered_map<KIID, BOARD_ITEM*>       m_itemByIdCache;
+    std::unordered_map<const BOARD_ITEM*, KIID> m_itemByIdCacheKeys;
+
     std::vector<BOARD_LISTENER*> m_listeners;
 };
 
@@ -363,7 +363,7 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
                     }
                     else
                     {
-                        board->Remove( boardItem, REMOVE_MODE::BULK );
+                        // Taken off the board in one go once all the changes are processed
                         bulkRemovedItems.push_back( boardItem );
                     }
                 }
@@ -382,7 +382,6 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
                     }
                     else
                     {
-                        board->Remove( boardItem, REMOVE_MODE::BULK );
                         bulkRemovedItems.push_back( boardItem );
                     }
                 }
@@ -391,7 +390,6 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
 
             // Metadata items
             case PCB_NETINFO_T:
-                board->Remove( boardItem, REMOVE_MODE::BULK );
                 bulkRemovedItems.push_back( boardItem );
                 break;
 
@@ -483,6 +481,15 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
                 } );
     }
 
+    // Listeners must not see the removed items still on the board
+    if( bulkRemovedItems.size() > 0 )
+    {
+        board->RemoveItems( bulkRemovedItems, REMOVE_MODE::BULK );
+
+        for( BOARD_ITEM* boardItem : bulkRemovedItems )
+            boardItem->ClearEditFlags();
+    }
+
     if( bulkAddedItems.size() > 0 )
         board->FinalizeBulkAdd( bulkAddedItems );
 
@@ -584,6 +591,10 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
             frame->Update3DView( true, frame->GetPcbNewSettings()->m_Display.m_Live3DRefresh );
     }
 
+#ifdef DEBUG
+    wxASSERT_MSG( board->CheckItemByIdCache(), wxT( "Board KIID index out of sync" ) );
+#endif
+
     clear();
 }
 
@@ -658,7 +669,6 @@ void BOARD_COMMIT::Revert()
             }
             else
             {
-                board->Remove( boardItem, REMOVE_MODE::BULK );
                 bulkRemovedItems.push_back( boardItem );
             }
 
@@ -717,6 +727,15 @@ void BOARD_COMMIT::Revert()
         boardItem->ClearEditFlags();
     }
 
+    // Listeners must not see the removed items still on the board
+    if( bulkRemovedItems.size() > 0 )
+    {
+        board->RemoveItems( bulkRemovedItems, REMOVE_MODE::BULK );
+
+        for( BOARD_ITEM* boardItem : bulkRemovedItems )
+            boardItem->ClearEditFlags();
+    }
+
     if( bulkAddedItems.size() > 0 )
         board->FinalizeBulkAdd( bulkAddedItems );
 
@@ -455,7 +455,8 @@ bool CONNECTIVITY_DATA::IsConnectedOnLayer( const BOARD_CONNECTED_ITEM *aItem, i
 
                     if( zone->IsFilled() )
                     {
-                        const SHAPE_POLY_SET*   zoneFill = zone->GetFill( ToLAYER_ID( aLayer ) );
+                        const SHAPE_POLY_SET*   zoneFill =
+                                zone->GetFilledPolysList( ToLAYER_ID( aLayer ) ).get();
                         const SHAPE_LINE_CHAIN& padHull = pad->GetEffectivePolygon( ERROR_INSIDE )->Outline( 0 );
 
                         for( const VECTOR2I& pt : zoneFill->COutline( islandIdx ).CPoints() )
@@ -479,7 +480,8 @@ bool CONNECTIVITY_DATA::IsConnectedOnLayer( const BOARD_CONNECTED_ITEM *aItem, i
 
                     if( zone->IsFilled() )
                     {
-                        const SHAPE_POLY_SET* zoneFill = zone->GetFill( ToLAYER_ID( aLayer ) );
+                        const SHAPE_POLY_SET* zoneFill =
+                                zone->GetFilledPolysList( ToLAYER_ID( aLayer ) ).get();
                         SHAPE_CIRCLE          viaHull( via->GetCenter(), via->GetWidth() / 2 );
 
                         for( const VECTOR2I& pt : zoneFill->COutline( islandIdx ).CPoints() )
@@ -667,6 +669,33 @@ void CONNECTIVITY_DATA::GetConnectedPadsAndVias( const BOARD_CONNECTED_ITEM* aIt
 }
 
 
+const std::vector<ZONE*>
+CONNECTIVITY_DATA::GetConnectedZones( const BOARD_CONNECTED_ITEM* aItem ) const
+{
+    std::vector<ZONE*> rv;
+
+    if( !m_connAlgo->ItemExists( aItem ) )
+        return rv;
+
+    for( CN_ITEM* citem : m_connAlgo->ItemEntry( aItem ).GetItems() )
+    {
+        for( CN_ITEM* connected : citem->ConnectedItems() )
+        {
+            if( connected->Valid() && connected->Parent()->Type() == PCB_ZONE_T )
+            {
+                ZONE* zone = static_cast<ZONE*>( connected->Parent() );
+
+                // A zone is connected through each of its layers
+                if( std::find( rv.begin(), rv.end(), zone ) == rv.end() )
+                    rv.push_back( zone );
+            }
+        }
+    }
+
+    return rv;
+}
+
+
 unsigned int CONNECTIVITY_DATA::GetNodeCount( int aNet ) const
 {
     int sum = 0;
@@ -199,6 +199,12 @@ public:
     void GetConnectedPadsAndVias( const BOARD_CONNECTED_ITEM* aItem, std::vector<PAD*>* pads,
                                   std::vector<PCB_VIA*>* vias );
 
+    /**
+     * @return the zones (teardrop areas included) directly connected to \a aItem, or nothing
+     *         if \a aItem is not in the connectivity data.
+     */
+    const std::vector<ZONE*> GetConnectedZones( const BOARD_CONNECTED_ITEM* aItem ) const;
+
     /**
      * Function GetConnectedItemsAtAnchor()
      * Returns a list of items connected to a source item aItem at position aAnchor
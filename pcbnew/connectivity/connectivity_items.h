@@ -297,7 +297,7 @@ public:
     bool ContainsPoint( const VECTOR2I& p ) const
     {
         if( m_zone->IsTeardropArea() )
-            return m_fillPoly->Outline( m_subpolyIndex ).Collide( p ) ;
+            return m_fillPoly->COutline( m_subpolyIndex ).Collide( p ) ;
 
         int  min[2] = { p.x, p.y };
         int  max[2] = { p.x, p.y };
@@ -327,7 +327,7 @@ public:
 
     const SHAPE_LINE_CHAIN& GetOutline() const
     {
-        return m_fillPoly->Outline( m_subpolyIndex );
+        return m_fillPoly->COutline( m_subpolyIndex );
     }
 
     bool Collide( SHAPE* aRefShape ) const
@@ -34,6 +34,7 @@
 #include <vector>
 
 #include <geometry/rtree.h>
+#include <geometry/seg_batch.h>
 #include <geometry/shape.h>
 #include <geometry/shape_segment.h>
 #include <math/vector2d.h>
@@ -272,7 +273,56 @@ public:
                     return true;
                 };
 
-        this->m_tree[aTargetLayer]->Search( min, max, visit );
+        SEG refSeg;
+        int refRadius;
+
+        if( !SEG_BATCH::AsSegment( refShape.get(), refSeg, refRadius ) )
+        {
+            this->m_tree[aTargetLayer]->Search( min, max, visit );
+            return count;
+        }
+
+        // Tracks and vias are narrowed down against the segments and circles of the tree as a
+        // single batch before the exact (and much more expensive) collision test.
+        std::vector<ITEM_WITH_SHAPE*> candidates;
+        std::vector<int>              batchSlots;
+        std::vector<uint8_t>          mayCollide;
+        SEG_BATCH                     batch;
+
+        auto collect =
+                [&]( ITEM_WITH_SHAPE* aItem ) -> bool
+                {
+                    SEG seg;
+                    int radius;
+
+                    candidates.push_back( aItem );
+
+                    if( aItem->parent != aRefItem
+                            && SEG_BATCH::AsSegment( aItem->shape, seg, radius ) )
+                    {
+                        batchSlots.push_back( (int) batch.Size() );
+                        batch.Add( seg, radius );
+                    }
+                    else
+                    {
+                        batchSlots.push_back( -1 );
+                    }
+
+                    return true;
+                };
+
+        this->m_tree[aTargetLayer]->Search( min, max, collect );
+        batch.MayCollide( refSeg, refRadius, aClearance, mayCollide );
+
+        for( size_t ii = 0; ii < candidates.size(); ++ii )
+        {
+            if( batchSlots[ii] >= 0 && !mayCollide[ batchSlots[ii] ] )
+                continue;
+
+            if( !visit( candidates[ii] ) )
+                break;
+        }
+
         return count;
     }
 
@@ -356,7 +406,7 @@ public:
                     wxASSERT( dynamic_cast<const SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRI*>( shape ) );
                     auto tri = static_cast<const SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRI*>( shape );
 
-                    const SHAPE_LINE_CHAIN& outline = poly->Outline( 0 );
+                    const SHAPE_LINE_CHAIN& outline = poly->COutline( 0 );
 
                     for( int ii = 0; ii < (int) tri->GetSegmentCount(); ++ii )
                     {
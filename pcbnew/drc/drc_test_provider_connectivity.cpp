@@ -128,7 +128,7 @@ bool DRC_TEST_PROVIDER_CONNECTIVITY::Run()
 
                 std::shared_ptr<DRC_ITEM> drcItem = DRC_ITEM::Create( DRCE_ISOLATED_COPPER );
                 drcItem->SetItems( zone );
-                reportViolation( drcItem, poly->Outline( polyIdx ).CPoint( 0 ), layer );
+                reportViolation( drcItem, poly->COutline( polyIdx ).CPoint( 0 ), layer );
             }
         }
     }
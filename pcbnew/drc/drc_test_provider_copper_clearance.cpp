@@ -1302,8 +1302,8 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testZonesToZones()
                     continue;
 
                 // Examine a candidate zone: compare zoneB to zoneA
-                SHAPE_POLY_SET* polyA = m_board->m_DRCCopperZones[ia]->GetFill( layer );
-                SHAPE_POLY_SET* polyB = m_board->m_DRCCopperZones[ia2]->GetFill( layer );
+                const SHAPE_POLY_SET* polyA = zoneA->GetFilledPolysList( layer ).get();
+                const SHAPE_POLY_SET* polyB = zoneB->GetFilledPolysList( layer ).get();
 
                 if( !polyA->BBoxFromCaches().Intersects( polyB->BBoxFromCaches() ) )
                     continue;
@@ -25,9 +25,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <future>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <wx/dir.h>
 #include <wx/filename.h>
 #include <wx/filefn.h>
 #include <wx/stdpaths.h>
@@ -40,8 +42,13 @@
 #include <pad.h>
 #include <pcb_track.h>
 #include <kiplatform/io.h>
+#include <math/util.h>
+#include <md5_hash.h>
+#include <paths.h>
 #include <string_utils.h>
 #include <build_version.h>
+#include <core/profile.h>
+#include <core/thread_pool.h>
 #include <geometry/shape_segment.h>
 
 #include "step_pcb_model.h"
@@ -57,6 +64,7 @@
 #include <STEPCAFControl_Reader.hxx>
 #include <STEPCAFControl_Writer.hxx>
 #include <APIHeaderSection_MakeHeader.hxx>
+#include <BinXCAFDrivers.hxx>
 #include <Standard_Version.hxx>
 #include <TCollection_ExtendedString.hxx>
 #include <TDataStd_Name.hxx>
@@ -110,6 +118,15 @@ static constexpr double USER_ANGLE_PREC = 1e-6;
 // nominal offset from the board
 static constexpr double BOARD_OFFSET = 0.05;
 
+// Bump this whenever the translation of the models changes, to discard the cached models
+static constexpr int MODEL_CACHE_VERSION = 1;
+
+// The model cache is trimmed to this size, least recently used models first
+static constexpr long long MODEL_CACHE_MAX_SIZE = 1024LL * 1024 * 1024;
+
+// Temporary files older than this are left over from a crashed export and can be deleted
+static constexpr long long MODEL_CACHE_TEMP_FILE_AGE_MS = 60LL * 60 * 1000;
+
 // supported file types for 3D models
 enum MODEL3D_FORMAT_TYPE
 {
@@ -192,6 +209,16 @@ STEP_PCB_MODEL::STEP_PCB_MODEL( const wxString& aPcbName )
 {
     m_app = XCAFApp_Application::GetApplication();
     m_app->NewDocument( "MDTV-XCAF", m_doc );
+
+    // The translated models are cached in the binary XCAF format
+    static bool cacheFormatDefined = false;
+
+    if( !cacheFormatDefined )
+    {
+        BinXCAFDrivers::DefineFormat( m_app );
+        cacheFormatDefined = true;
+    }
+
     m_assy = XCAFDoc_DocumentTool::ShapeTool( m_doc->Main() );
     m_assy_label = m_assy->NewShape();
     m_hasPCB = false;
@@ -890,6 +917,8 @@ bool STEP_PCB_MODEL::CreatePCB( SHAPE_POLY_SET& aOutline, VECTOR2D aOrigin )
     Handle( XCAFDoc_ColorTool ) colorTool = XCAFDoc_DocumentTool::ColorTool( m_doc->Main() );
     m_hasPCB = true; // whether or not operations fail we note that CreatePCB has been invoked
 
+    PROF_TIMER stageTimer;
+
 
     // Support for more than one main outline (more than one board)
     for( int cnt = 0; cnt < aOutline.OutlineCount(); cnt++ )
@@ -908,6 +937,9 @@ bool STEP_PCB_MODEL::CreatePCB( SHAPE_POLY_SET& aOutline, VECTOR2D aOrigin )
         }
     }
 
+    ReportMessage( wxString::Format( wxT( "Built board outlines in %.3f s\n" ),
+                                     stageTimer.msecs() / 1000.0 ) );
+
     Bnd_Box brdBndBox;
 
     for( const TopoDS_Shape& brdShape : m_board_outlines )
@@ -939,46 +971,90 @@ bool STEP_PCB_MODEL::CreatePCB( SHAPE_POLY_SET& aOutline, VECTOR2D aOrigin )
     auto subtractShapes = []( const wxString& aWhat, std::vector<TopoDS_Shape>& aShapesList,
                               std::vector<TopoDS_Shape>& aHolesList, Bnd_BoundSortBox& aBSBHoles )
     {
-        // Remove holes for each item (board body or bodies, one can have more than one board)
-        int cnt = 0;
-        for( TopoDS_Shape& shape : aShapesList )
+        if( aShapesList.empty() )
+            return;
+
+        PROF_TIMER timer;
+
+        // Look up the holes of each item (board body or bodies, one can have more than one
+        // board) first: Bnd_BoundSortBox is not thread safe, but once the lists are built the
+        // cuts are independent of each other.
+        std::vector<TopTools_ListOfShape> holeLists( aShapesList.size() );
+
+        for( size_t ii = 0; ii < aShapesList.size(); ++ii )
         {
             Bnd_Box shapeBbox;
-            BRepBndLib::Add( shape, shapeBbox );
+            BRepBndLib::Add( aShapesList[ii], shapeBbox );
+
+            for( const Standard_Integer& index : aBSBHoles.Compare( shapeBbox ) )
+                holeLists[ii].Append( aHolesList[index] );
+        }
+
+        ReportMessage( wxString::Format( _( "Build holes for %s\n" ), aWhat ) );
 
-            const TColStd_ListOfInteger& indices = aBSBHoles.Compare( shapeBbox );
+        auto cutHoles =
+                [&]( size_t aIndex )
+                {
+                    if( holeLists[aIndex].IsEmpty() )
+                        return;
 
-            TopTools_ListOfShape holelist;
+                    TopTools_ListOfShape cutArgs;
+                    cutArgs.Append( aShapesList[aIndex] );
 
-            for( const Standard_Integer& index : indices )
-                holelist.Append( aHolesList[index] );
+                    BRepAlgoAPI_Cut cut;
 
-            if( cnt == 0 )
-                ReportMessage( wxString::Format( _( "Build holes for %s\n" ), aWhat ) );
+                    // This helps cutting circular holes in zones where a hole is already cut in
+                    // Clipper
+                    cut.SetFuzzyValue( 0.0005 );
 
-            cnt++;
+                    // The hole shapes are shared by the cuts running concurrently, so they must
+                    // not be touched
+                    cut.SetNonDestructive( Standard_True );
+                    cut.SetRunParallel( Standard_True );
+                    cut.SetArguments( cutArgs );
 
-            if( cnt % 10 == 0 )
-                ReportMessage( wxString::Format( _( "Cutting %d/%d %s\n" ), cnt,
-                                                 (int) aShapesList.size(), aWhat ) );
+                    cut.SetTools( holeLists[aIndex] );
+                    cut.Build();
 
-            if( holelist.IsEmpty() )
-                continue;
+                    aShapesList[aIndex] = cut.Shape();
+                };
 
-            TopTools_ListOfShape cutArgs;
-            cutArgs.Append( shape );
+        thread_pool&                   tp = GetKiCadThreadPool();
+        std::vector<std::future<void>> returns;
 
-            BRepAlgoAPI_Cut cut;
+        returns.reserve( aShapesList.size() );
 
-            // This helps cutting circular holes in zones where a hole is already cut in Clipper
-            cut.SetFuzzyValue( 0.0005 );
-            cut.SetArguments( cutArgs );
+        for( size_t ii = 0; ii < aShapesList.size(); ++ii )
+            returns.emplace_back( tp.submit( cutHoles, ii ) );
 
-            cut.SetTools( holelist );
-            cut.Build();
+        // Any OCC exception is passed on by get(), but only once all the cuts using the shape
+        // lists are done
+        std::exception_ptr failure;
 
-            shape = cut.Shape();
+        for( size_t ii = 0; ii < returns.size(); ++ii )
+        {
+            try
+            {
+                returns[ii].get();
+            }
+            catch( ... )
+            {
+                if( !failure )
+                    failure = std::current_exception();
+            }
+
+            if( ( ii + 1 ) % 10 == 0 )
+            {
+                ReportMessage( wxString::Format( _( "Cutting %d/%d %s\n" ), (int) ii + 1,
+                                                 (int) aShapesList.size(), aWhat ) );
+            }
         }
+
+        if( failure )
+            std::rethrow_exception( failure );
+
+        ReportMessage( wxString::Format( wxT( "Cut %d %s in %.3f s\n" ), (int) aShapesList.size(),
+                                         aWhat, timer.msecs() / 1000.0 ) );
     };
 
     if( m_boardCutouts.size() )
@@ -1001,6 +1077,7 @@ bool STEP_PCB_MODEL::CreatePCB( SHAPE_POLY_SET& aOutline, VECTOR2D aOrigin )
 
     // push the board to the data structure
     ReportMessage( wxT( "\nGenerate board full shape.\n" ) );
+    stageTimer.Start();
 
     auto pushToAssembly = [&]( std::vector<TopoDS_Shape>& aShapesList, Quantity_Color aColor,
                                const wxString& aShapeName )
@@ -1064,6 +1141,9 @@ bool STEP_PCB_MODEL::CreatePCB( SHAPE_POLY_SET& aOutline, VECTOR2D aOrigin )
     m_assy->UpdateAssemblies();
 #endif
 
+    ReportMessage( wxString::Format( wxT( "Generated board full shape in %.3f s\n" ),
+                                     stageTimer.msecs() / 1000.0 ) );
+
     return true;
 }
 
@@ -1202,25 +1282,39 @@ bool STEP_PCB_MODEL::getModelLabel( const std::string& aFileNameUTF8, VECTOR3D a
 
     wxString fileName( wxString::FromUTF8( aFileNameUTF8.c_str() ) );
     MODEL3D_FORMAT_TYPE modelFmt = fileType( aFileNameUTF8.c_str() );
+    wxString cacheFile;
+
+    if( modelFmt == FMT_IGES || modelFmt == FMT_STEP )
+        cacheFile = modelCacheFileName( fileName );
 
     switch( modelFmt )
     {
     case FMT_IGES:
+        if( readCachedModel( doc, cacheFile ) )
+            break;
+
         if( !readIGES( doc, aFileNameUTF8.c_str() ) )
         {
             ReportMessage( wxString::Format( wxT( "readIGES() failed on filename '%s'.\n" ),
                                              fileName ) );
             return false;
         }
+
+        writeCachedModel( doc, cacheFile );
         break;
 
     case FMT_STEP:
+        if( readCachedModel( doc, cacheFile ) )
+            break;
+
         if( !readSTEP( doc, aFileNameUTF8.c_str() ) )
         {
             ReportMessage( wxString::Format( wxT( "readSTEP() failed on filename '%s'.\n" ),
                                              fileName ) );
             return false;
         }
+
+        writeCachedModel( doc, cacheFile );
         break;
 
     case FMT_STEPZ:
@@ -1383,6 +1477,11 @@ bool STEP_PCB_MODEL::getModelLabel( const std::string& aFileNameUTF8, VECTOR3D a
 
     aLabel = transferModel( doc, m_doc, aScale );
 
+    // The model is copied into m_doc: drop the source document from the application session,
+    // or opening its cache file again would be refused as already retrieved
+    if( doc->CanClose() == CDM_CCS_OK )
+        m_app->Close( doc );
+
     if( aLabel.IsNull() )
     {
         ReportMessage( wxString::Format( wxT( "Could not transfer model data from file '%s'.\n" ),
@@ -1544,6 +1643,172 @@ bool STEP_PCB_MODEL::readSTEP( Handle( TDocStd_Document )& doc, const char* fnam
 }
 
 
+wxString STEP_PCB_MODEL::modelCacheFileName( const wxString& aFileName )
+{
+    wxFileName cacheFn;
+
+    cacheFn.AssignDir( PATHS::GetUserCachePath() );
+    cacheFn.AppendDir( wxT( "step_models" ) );
+
+    if( !PATHS::EnsurePathExists( cacheFn.GetPath() ) )
+        return wxEmptyString;
+
+    FILE* fp = wxFopen( aFileName, wxT( "rb" ) );
+
+    if( !fp )
+        return wxEmptyString;
+
+    MD5_HASH hash;
+    uint8_t  block[4096];
+    size_t   bsize = 0;
+
+    // The translation settings and the OCC version are hashed along with the model, as they
+    // change the result
+    hash.Hash( MODEL_CACHE_VERSION );
+    hash.Hash( OCC_VERSION_HEX );
+    hash.Hash( KiROUND( USER_PREC * 1e9 ) );
+
+    while( ( bsize = fread( block, 1, sizeof( block ), fp ) ) > 0 )
+        hash.Hash( block, (uint32_t) bsize );
+
+    fclose( fp );
+    hash.Finalize();
+
+    cacheFn.SetName( hash.Format( true ) );
+    cacheFn.SetExt( wxT( "xbf" ) );
+
+    return cacheFn.GetFullPath();
+}
+
+
+bool STEP_PCB_MODEL::readCachedModel( Handle( TDocStd_Document )& aDoc,
+                                      const wxString& aCacheFile )
+{
+    if( aCacheFile.IsEmpty() || !wxFileName::FileExists( aCacheFile ) )
+        return false;
+
+    Handle( TDocStd_Document ) cached;
+
+    try
+    {
+        TCollection_ExtendedString path( aCacheFile.utf8_str().data(), Standard_True );
+
+        if( m_app->Open( path, cached ) != PCDM_RS_OK )
+            return false;
+    }
+    catch( const Standard_Failure& )
+    {
+        // a damaged cache file; the model will be translated and cached again
+        return false;
+    }
+
+    if( aDoc->CanClose() == CDM_CCS_OK )
+        m_app->Close( aDoc );
+
+    aDoc = cached;
+
+    // Mark the model as recently used so that it is the last to be pruned from the cache
+    wxFileName( aCacheFile ).Touch();
+    return true;
+}
+
+
+void STEP_PCB_MODEL::writeCachedModel( Handle( TDocStd_Document )& aDoc,
+                                       const wxString& aCacheFile )
+{
+    if( aCacheFile.IsEmpty() )
+        return;
+
+    // Write to a temporary file first so that a concurrent export never reads a partial model.
+    // It is named "<model>.xbf.tmpXXXXXX" so that pruneModelCache() can find it if it is left
+    // behind.
+    wxString tmpPath = wxFileName::CreateTempFileName( aCacheFile + wxT( ".tmp" ) );
+
+    if( tmpPath.IsEmpty() )
+        return;
+
+    try
+    {
+        TCollection_ExtendedString path( tmpPath.utf8_str().data(), Standard_True );
+
+        aDoc->ChangeStorageFormat( "BinXCAF" );
+
+        if( m_app->SaveAs( aDoc, path ) == PCDM_SS_OK && wxRenameFile( tmpPath, aCacheFile, true ) )
+        {
+            pruneModelCache( wxFileName( aCacheFile ).GetPath() );
+            return;
+        }
+    }
+    catch( const Standard_Failure& )
+    {
+    }
+
+    // its not the end of the world since this is just a cache file
+    wxRemoveFile( tmpPath );
+}
+
+
+void STEP_PCB_MODEL::pruneModelCache( const wxString& aCacheDir )
+{
+    struct CACHED_MODEL
+    {
+        long long m_Time;
+        long long m_Size;
+        wxString  m_Path;
+    };
+
+    wxDir dir( aCacheDir );
+
+    if( !dir.IsOpened() )
+        return;
+
+    std::vector<CACHED_MODEL> models;
+    long long                 total = 0;
+    wxString                  name;
+
+    long long                 now = wxDateTime::UNow().GetValue().GetValue();
+
+    for( bool found = dir.GetFirst( &name, wxT( "*.xbf*" ), wxDIR_FILES ); found;
+         found = dir.GetNext( &name ) )
+    {
+        wxFileName fn( aCacheDir, name );
+        long long  time = fn.GetModificationTime().GetValue().GetValue();
+
+        if( fn.GetExt() != wxT( "xbf" ) )
+        {
+            // A temporary file which another export may still be writing is left alone
+            if( now - time > MODEL_CACHE_TEMP_FILE_AGE_MS )
+                wxRemoveFile( fn.GetFullPath() );
+
+            continue;
+        }
+
+        long long size = fn.GetSize().GetValue();
+
+        models.push_back( { time, size, fn.GetFullPath() } );
+        total += size;
+    }
+
+    if( total <= MODEL_CACHE_MAX_SIZE )
+        return;
+
+    std::sort( models.begin(), models.end(),
+               []( const CACHED_MODEL& aLhs, const CACHED_MODEL& aRhs )
+               {
+                   return aLhs.m_Time < aRhs.m_Time;
+               } );
+
+    for( const CACHED_MODEL& model : models )
+    {
+        if( total <= MODEL_CACHE_MAX_SIZE )
+            break;
+
+        if( wxRemoveFile( model.m_Path ) )
+            total -= model.m_Size;
+    }
+}
+
+
 TDF_Label STEP_PCB_MODEL::transferModel( Handle( TDocStd_Document )& source,
                                    Handle( TDocStd_Document )& dest, VECTOR3D aScale )
 {
@@ -218,6 +218,36 @@ private:
     bool readIGES( Handle( TDocStd_Document )& m_doc, const char* fname );
     bool readSTEP( Handle( TDocStd_Document )& m_doc, const char* fname );
 
+    /**
+     * Get the file of the on-disk model cache which holds the translation of a model file.
+     *
+     * The cache is shared by all exports: its files are named after a hash of the content of
+     * the model file, so a model is only translated again if it changes.
+     *
+     * @param aFileName is the STEP or IGES model file.
+     * @return the cache file name, or an empty string if the model cannot be cached.
+     */
+    wxString modelCacheFileName( const wxString& aFileName );
+
+    /**
+     * Load a model translated by an earlier export.
+     *
+     * @return false if the model is not in the cache.
+     */
+    bool readCachedModel( Handle( TDocStd_Document )& aDoc, const wxString& aCacheFile );
+
+    /**
+     * Store a translated model in the cache.  Failures are ignored, the model will just be
+     * translated again next time.
+     */
+    void writeCachedModel( Handle( TDocStd_Document )& aDoc, const wxString& aCacheFile );
+
+    /**
+     * Delete the least recently used models of the cache until it fits in its size limit, and
+     * the temporary files left behind by interrupted exports.
+     */
+    static void pruneModelCache( const wxString& aCacheDir );
+
     TDF_Label transferModel( Handle( TDocStd_Document )& source, Handle( TDocStd_Document ) & dest,
                              VECTOR3D aScale );
 
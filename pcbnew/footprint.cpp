@@ -213,6 +213,10 @@ FOOTPRINT::FOOTPRINT( FOOTPRINT&& aFootprint ) :
 
 FOOTPRINT::~FOOTPRINT()
 {
+    // Drop ourselves and our children from the board's KIID index while they are still alive
+    if( BOARD* board = GetBoard() )
+        board->UncacheItemById( this );
+
     // Untangle group parents before doing any deleting
     for( PCB_GROUP* group : m_groups )
     {
@@ -334,6 +338,12 @@ PCB_FIELD* FOOTPRINT::AddField( const PCB_FIELD& aField )
     int newNdx = m_fields.size();
 
     m_fields.push_back( new PCB_FIELD( aField ) );
+
+    BOARD* board = GetBoard();
+
+    if( board && board->IsItemCachedById( this ) )
+        board->CacheItemById( m_fields[newNdx] );
+
     return m_fields[newNdx];
 }
 
@@ -344,6 +354,9 @@ void FOOTPRINT::RemoveField( const wxString& aFieldName )
     {
         if( aFieldName == m_fields[i]->GetName( false ) )
         {
+            if( BOARD* board = GetBoard() )
+                board->UncacheItemById( m_fields[i] );
+
             m_fields.erase( m_fields.begin() + i );
             return;
         }
@@ -424,6 +437,16 @@ bool FOOTPRINT::FixUuids()
 
 FOOTPRINT& FOOTPRINT::operator=( FOOTPRINT&& aOther )
 {
+    // Our current children are about to be replaced; the new ones are indexed by Add()
+    if( BOARD* board = GetBoard(); board && board->IsItemCachedById( this ) )
+    {
+        RunOnChildren(
+                [&]( BOARD_ITEM* aChild )
+                {
+                    board->UncacheItemById( aChild );
+                } );
+    }
+
     BOARD_ITEM::operator=( aOther );
 
     m_pos           = aOther.m_pos;
@@ -518,6 +541,16 @@ FOOTPRINT& FOOTPRINT::operator=( FOOTPRINT&& aOther )
 
 FOOTPRINT& FOOTPRINT::operator=( const FOOTPRINT& aOther )
 {
+    // Our current children are about to be replaced; the new ones are indexed by Add()
+    if( BOARD* board = GetBoard(); board && board->IsItemCachedById( this ) )
+    {
+        RunOnChildren(
+                [&]( BOARD_ITEM* aChild )
+                {
+                    board->UncacheItemById( aChild );
+                } );
+    }
+
     BOARD_ITEM::operator=( aOther );
 
     m_pos           = aOther.m_pos;
@@ -776,6 +809,12 @@ void FOOTPRINT::Add( BOARD_ITEM* aBoardItem, ADD_MODE aMode, bool aSkipConnectiv
 
     aBoardItem->ClearEditFlags();
     aBoardItem->SetParent( this );
+
+    // Items of a footprint which is on a board are looked up by KIID through the board
+    BOARD* board = GetBoard();
+
+    if( board && board->IsItemCachedById( this ) )
+        board->CacheItemById( aBoardItem );
 }
 
 
@@ -868,6 +907,9 @@ void FOOTPRINT::Remove( BOARD_ITEM* aBoardItem, REMOVE_MODE aMode )
 
     aBoardItem->SetFlags( STRUCT_DELETED );
 
+    if( BOARD* board = GetBoard() )
+        board->UncacheItemById( aBoardItem );
+
     PCB_GROUP* parentGroup = aBoardItem->GetParentGroup();
 
     if( parentGroup && !( parentGroup->GetFlags() & STRUCT_DELETED ) )
@@ -3023,6 +3065,7 @@ void FOOTPRINT::swapData( BOARD_ITEM* aImage )
     wxASSERT( aImage->Type() == PCB_FOOTPRINT_T );
 
     FOOTPRINT* image = static_cast<FOOTPRINT*>( aImage );
+    BOARD*     board = GetBoard();
 
     std::swap( *this, *image );
 
@@ -3037,6 +3080,22 @@ void FOOTPRINT::swapData( BOARD_ITEM* aImage )
             {
                 child->SetParent( image );
             } );
+
+    // The children were exchanged too: the board must now find ours instead of the image's
+    if( board && board->IsItemCachedById( this ) )
+    {
+        image->RunOnChildren(
+                [&]( BOARD_ITEM* child )
+                {
+                    board->UncacheItemById( child );
+                } );
+
+        RunOnChildren(
+                [&]( BOARD_ITEM* child )
+                {
+                    board->CacheItemById( child );
+                } );
+    }
 }
 
 
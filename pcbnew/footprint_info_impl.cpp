@@ -22,6 +22,7 @@
 
 #include <footprint_info_impl.h>
 
+#include <cache_file.h>
 #include <dialogs/html_message_box.h>
 #include <footprint.h>
 #include <footprint_info.h>
@@ -34,11 +35,7 @@
 #include <core/thread_pool.h>
 #include <wildcards_and_files_ext.h>
 
-#include <kiplatform/io.h>
-
 #include <wx/textfile.h>
-#include <wx/txtstrm.h>
-#include <wx/wfstream.h>
 
 
 void FOOTPRINT_INFO_IMPL::load()
@@ -47,19 +44,20 @@ void FOOTPRINT_INFO_IMPL::load()
 
     wxASSERT( fptable );
 
-    const FOOTPRINT* footprint = fptable->GetEnumeratedFootprint( m_nickname, m_fpname );
+    FOOTPRINT_METADATA metadata;
 
-    if( footprint == nullptr ) // Should happen only with malformed/broken libraries
+    // Should fail only with malformed/broken libraries
+    if( fptable->GetEnumeratedFootprintMetadata( m_nickname, m_fpname, metadata ) )
     {
-        m_pad_count = 0;
-        m_unique_pad_count = 0;
+        m_pad_count = metadata.m_PadCount;
+        m_unique_pad_count = metadata.m_UniquePadCount;
+        m_keywords = metadata.m_Keywords;
+        m_doc = metadata.m_Description;
     }
     else
     {
-        m_pad_count = footprint->GetPadCount( DO_NOT_INCLUDE_NPTH );
-        m_unique_pad_count = footprint->GetUniquePadCount( DO_NOT_INCLUDE_NPTH );
-        m_keywords = footprint->GetKeywords();
-        m_doc = footprint->GetLibDescription();
+        m_pad_count = 0;
+        m_unique_pad_count = 0;
     }
 
     m_loaded = true;
@@ -308,40 +306,21 @@ FOOTPRINT_LIST_IMPL::FOOTPRINT_LIST_IMPL() :
 
 void FOOTPRINT_LIST_IMPL::WriteCacheToFile( const wxString& aFilePath )
 {
-    wxFileName          tmpFileName = wxFileName::CreateTempFileName( aFilePath );
-    wxFFileOutputStream outStream( tmpFileName.GetFullPath() );
-    wxTextOutputStream  txtStream( outStream );
-
-    if( !outStream.IsOk() )
-    {
-        return;
-    }
-
-    txtStream << wxString::Format( wxT( "%lld" ), m_list_timestamp ) << endl;
+    wxString content = wxString::Format( wxT( "%lld\n" ), m_list_timestamp );
 
     for( std::unique_ptr<FOOTPRINT_INFO>& fpinfo : m_list )
     {
-        txtStream << fpinfo->GetLibNickname() << endl;
-        txtStream << fpinfo->GetName() << endl;
-        txtStream << EscapeString( fpinfo->GetDescription(), CTX_LINE ) << endl;
-        txtStream << EscapeString( fpinfo->GetKeywords(), CTX_LINE ) << endl;
-        txtStream << wxString::Format( wxT( "%d" ), fpinfo->GetOrderNum() ) << endl;
-        txtStream << wxString::Format( wxT( "%u" ), fpinfo->GetPadCount() ) << endl;
-        txtStream << wxString::Format( wxT( "%u" ), fpinfo->GetUniquePadCount() ) << endl;
+        content << fpinfo->GetLibNickname() << wxT( "\n" );
+        content << fpinfo->GetName() << wxT( "\n" );
+        content << EscapeString( fpinfo->GetDescription(), CTX_LINE ) << wxT( "\n" );
+        content << EscapeString( fpinfo->GetKeywords(), CTX_LINE ) << wxT( "\n" );
+        content << wxString::Format( wxT( "%d\n" ), fpinfo->GetOrderNum() );
+        content << wxString::Format( wxT( "%u\n" ), fpinfo->GetPadCount() );
+        content << wxString::Format( wxT( "%u\n" ), fpinfo->GetUniquePadCount() );
     }
 
-    txtStream.Flush();
-    outStream.Close();
-
-    // Preserve the permissions of the current file
-    KIPLATFORM::IO::DuplicatePermissions( aFilePath, tmpFileName.GetFullPath() );
-
-    if( !wxRenameFile( tmpFileName.GetFullPath(), aFilePath, true ) )
-    {
-        // cleanup in case rename failed
-        // its also not the end of the world since this is just a cache file
-        wxRemoveFile( tmpFileName.GetFullPath() );
-    }
+    // its not the end of the world if this fails since this is just a cache file
+    CACHE_FILE::Write( aFilePath, std::string( content.utf8_str() ) );
 }
 
 
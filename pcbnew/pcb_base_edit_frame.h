@@ -210,6 +210,8 @@ public:
 
     void ClearListAndDeleteItems( PICKED_ITEMS_LIST* aList );
 
+    size_t GetUndoCommandMemory( const PICKED_ITEMS_LIST* aCommand ) const override;
+
     /**
      * Return the absolute path to the design rules file for the currently-loaded board.
      *
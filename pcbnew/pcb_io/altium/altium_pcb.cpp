@@ -35,6 +35,7 @@
 #include <pcb_text.h>
 #include <pcb_track.h>
 #include <core/profile.h>
+#include <core/thread_pool.h>
 #include <string_utils.h>
 #include <zone.h>
 
@@ -44,6 +45,7 @@
 #include <convert_basic_shapes_to_polygon.h>
 #include <font/outline_font.h>
 #include <project.h>
+#include <trace_helpers.h>
 #include <trigo.h>
 #include <utf.h>
 #include <wx/docview.h>
@@ -471,6 +473,8 @@ void ALTIUM_PCB::Parse( const ALTIUM_COMPOUND_FILE&                  altiumPcbFi
         }
     }
 
+    DecodePrimitiveStreams( altiumPcbFile, aFileMapping );
+
     // Parse data in specified order
     for( const std::tuple<bool, ALTIUM_PCB_DIR, PARSE_FUNCTION_POINTER_fp>& cur : parserOrder )
     {
@@ -499,7 +503,12 @@ void ALTIUM_PCB::Parse( const ALTIUM_COMPOUND_FILE&                  altiumPcbFi
 
         if( file != nullptr )
         {
+            PROF_TIMER timer;
+
             fp( altiumPcbFile, file );
+
+            wxLogTrace( traceAltiumPcbPlugin, wxT( "%s converted in %.1f ms" ),
+                        magic_enum::enum_name( directory ), timer.msecs() );
         }
         else if( isRequired )
         {
@@ -544,7 +553,7 @@ void ALTIUM_PCB::Parse( const ALTIUM_COMPOUND_FILE&                  altiumPcbFi
             if( !zone->HasFilledPolysForLayer( layer ) )
                 continue;
 
-            zone->GetFilledPolysList( layer )->Fracture( SHAPE_POLY_SET::PM_STRICTLY_SIMPLE );
+            zone->GetFill( layer )->Fracture( SHAPE_POLY_SET::PM_STRICTLY_SIMPLE );
         }
     }
 
@@ -842,6 +851,124 @@ const ARULE6* ALTIUM_PCB::GetRuleDefault( ALTIUM_RULE_KIND aKind ) const
     return nullptr;
 }
 
+
+/**
+ * Decode all the records of a binary stream.
+ */
+template <typename RECORD, typename... ARGS>
+static void decodeStream( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
+                          const CFB::COMPOUND_FILE_ENTRY* aEntry, const wxString& aStreamName,
+                          std::vector<RECORD>& aRecords, ARGS... aArgs )
+{
+    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
+
+    while( reader.GetRemainingBytes() >= 4 /* TODO: use Header section of file */ )
+        aRecords.emplace_back( reader, aArgs... );
+
+    if( reader.GetRemainingBytes() != 0 )
+        THROW_IO_ERROR( wxString::Format( wxT( "%s stream is not fully parsed" ), aStreamName ) );
+}
+
+
+void ALTIUM_PCB::DecodePrimitiveStreams( const ALTIUM_COMPOUND_FILE& aAltiumPcbFile,
+                                         const std::map<ALTIUM_PCB_DIR, std::string>& aFileMapping )
+{
+    struct DECODE_JOB
+    {
+        ALTIUM_PCB_DIR                                         m_Directory;
+        std::function<void( const CFB::COMPOUND_FILE_ENTRY* )> m_Decode;
+        const CFB::COMPOUND_FILE_ENTRY*                        m_Entry = nullptr;
+        std::exception_ptr                                     m_Error;
+        double                                                 m_Msecs = 0.0;
+    };
+
+    std::vector<DECODE_JOB> jobs = {
+        { ALTIUM_PCB_DIR::ARCS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "Arcs6" ), m_arcs6 );
+          } },
+        { ALTIUM_PCB_DIR::PADS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "Pads6" ), m_pads6 );
+          } },
+        { ALTIUM_PCB_DIR::VIAS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "Vias6" ), m_vias6 );
+          } },
+        { ALTIUM_PCB_DIR::TRACKS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "Tracks6" ), m_tracks6 );
+          } },
+        { ALTIUM_PCB_DIR::FILLS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "Fills6" ), m_fills6 );
+          } },
+        { ALTIUM_PCB_DIR::SHAPEBASEDREGIONS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "ShapeBasedRegions6" ),
+                            m_shapeBasedRegions6, true );
+          } },
+        { ALTIUM_PCB_DIR::REGIONS6,
+          [&]( const CFB::COMPOUND_FILE_ENTRY* aEntry )
+          {
+              decodeStream( aAltiumPcbFile, aEntry, wxT( "Regions6" ), m_regions6, false );
+          } }
+    };
+
+    for( DECODE_JOB& job : jobs )
+    {
+        const auto& mappedDirectory = aFileMapping.find( job.m_Directory );
+
+        if( mappedDirectory != aFileMapping.end() )
+            job.m_Entry = aAltiumPcbFile.FindStream( { mappedDirectory->second, "Data" } );
+    }
+
+    if( m_progressReporter )
+        m_progressReporter->Report( _( "Reading primitives..." ) );
+
+    // The decoders only read the (in-memory) compound file and write their own record list
+    RunOnThreadPool( jobs.size(),
+            [&]( size_t aIdx )
+            {
+                DECODE_JOB& job = jobs[aIdx];
+
+                if( !job.m_Entry )
+                    return;
+
+                PROF_TIMER timer;
+
+                try
+                {
+                    job.m_Decode( job.m_Entry );
+                }
+                catch( ... )
+                {
+                    job.m_Error = std::current_exception();
+                }
+
+                job.m_Msecs = timer.msecs();
+            } );
+
+    for( const DECODE_JOB& job : jobs )
+    {
+        if( !job.m_Entry )
+            continue;
+
+        wxLogTrace( traceAltiumPcbPlugin, wxT( "%s decoded in %.1f ms" ),
+                    magic_enum::enum_name( job.m_Directory ), job.m_Msecs );
+
+        if( job.m_Error )
+            std::rethrow_exception( job.m_Error );
+    }
+}
+
+
 void ALTIUM_PCB::ParseFileHeader( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
                                   const CFB::COMPOUND_FILE_ENTRY* aEntry )
 {
@@ -1948,13 +2075,11 @@ void ALTIUM_PCB::ParseShapeBasedRegions6Data( const ALTIUM_COMPOUND_FILE&     aA
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading polygons..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    /* TODO: use Header section of file */
-    for( int primitiveIndex = 0; reader.GetRemainingBytes() >= 4; primitiveIndex++ )
+    for( int primitiveIndex = 0; primitiveIndex < (int) m_shapeBasedRegions6.size();
+         primitiveIndex++ )
     {
         checkpoint();
-        AREGION6 elem( reader, true );
+        const AREGION6& elem = m_shapeBasedRegions6[primitiveIndex];
 
         if( elem.component == ALTIUM_COMPONENT_NONE
             || elem.kind == ALTIUM_REGION_KIND::BOARD_CUTOUT )
@@ -1969,8 +2094,7 @@ void ALTIUM_PCB::ParseShapeBasedRegions6Data( const ALTIUM_COMPOUND_FILE&     aA
         }
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( "ShapeBasedRegions6 stream is not fully parsed" );
+    m_shapeBasedRegions6.clear();
 }
 
 
@@ -2351,12 +2475,9 @@ void ALTIUM_PCB::ParseRegions6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFi
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading zone fills..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    while( reader.GetRemainingBytes() >= 4 /* TODO: use Header section of file */ )
+    for( const AREGION6& elem : m_regions6 )
     {
         checkpoint();
-        AREGION6 elem( reader, false );
 
         if( elem.polygon != ALTIUM_POLYGON_NONE )
         {
@@ -2415,8 +2536,7 @@ void ALTIUM_PCB::ParseRegions6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFi
         }
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( wxT( "Regions6 stream is not fully parsed" ) );
+    m_regions6.clear();
 }
 
 
@@ -2426,12 +2546,10 @@ void ALTIUM_PCB::ParseArcs6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading arcs..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    for( int primitiveIndex = 0; reader.GetRemainingBytes() >= 4; primitiveIndex++ )
+    for( int primitiveIndex = 0; primitiveIndex < (int) m_arcs6.size(); primitiveIndex++ )
     {
         checkpoint();
-        AARC6 elem( reader );
+        const AARC6& elem = m_arcs6[primitiveIndex];
 
         if( elem.component == ALTIUM_COMPONENT_NONE )
         {
@@ -2444,8 +2562,7 @@ void ALTIUM_PCB::ParseArcs6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
         }
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( "Arcs6 stream is not fully parsed" );
+    m_arcs6.clear();
 }
 
 
@@ -2669,12 +2786,9 @@ void ALTIUM_PCB::ParsePads6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading pads..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    while( reader.GetRemainingBytes() >= 4 /* TODO: use Header section of file */ )
+    for( const APAD6& elem : m_pads6 )
     {
         checkpoint();
-        APAD6 elem( reader );
 
         if( elem.component == ALTIUM_COMPONENT_NONE )
         {
@@ -2687,8 +2801,7 @@ void ALTIUM_PCB::ParsePads6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
         }
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( wxT( "Pads6 stream is not fully parsed" ) );
+    m_pads6.clear();
 }
 
 
@@ -3213,12 +3326,9 @@ void ALTIUM_PCB::ParseVias6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading vias..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    while( reader.GetRemainingBytes() >= 4 /* TODO: use Header section of file */ )
+    for( const AVIA6& elem : m_vias6 )
     {
         checkpoint();
-        AVIA6 elem( reader );
 
         PCB_VIA* via = new PCB_VIA( m_board );
         m_board->Add( via, ADD_MODE::APPEND );
@@ -3263,8 +3373,7 @@ void ALTIUM_PCB::ParseVias6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
         via->SetLayerPair( start_klayer, end_klayer );
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( wxT( "Vias6 stream is not fully parsed" ) );
+    m_vias6.clear();
 }
 
 void ALTIUM_PCB::ParseTracks6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
@@ -3273,12 +3382,10 @@ void ALTIUM_PCB::ParseTracks6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFil
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading tracks..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    for( int primitiveIndex = 0; reader.GetRemainingBytes() >= 4; primitiveIndex++ )
+    for( int primitiveIndex = 0; primitiveIndex < (int) m_tracks6.size(); primitiveIndex++ )
     {
         checkpoint();
-        ATRACK6 elem( reader );
+        const ATRACK6& elem = m_tracks6[primitiveIndex];
 
         if( elem.component == ALTIUM_COMPONENT_NONE )
         {
@@ -3291,8 +3398,7 @@ void ALTIUM_PCB::ParseTracks6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFil
         }
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( "Tracks6 stream is not fully parsed" );
+    m_tracks6.clear();
 }
 
 
@@ -3657,12 +3763,9 @@ void ALTIUM_PCB::ParseFills6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile
     if( m_progressReporter )
         m_progressReporter->Report( _( "Loading rectangles..." ) );
 
-    ALTIUM_PARSER reader( aAltiumPcbFile, aEntry );
-
-    while( reader.GetRemainingBytes() >= 4 /* TODO: use Header section of file */ )
+    for( const AFILL6& elem : m_fills6 )
     {
         checkpoint();
-        AFILL6 elem( reader );
 
         if( elem.component == ALTIUM_COMPONENT_NONE )
         {
@@ -3675,8 +3778,7 @@ void ALTIUM_PCB::ParseFills6Data( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile
         }
     }
 
-    if( reader.GetRemainingBytes() != 0 )
-        THROW_IO_ERROR( "Fills6 stream is not fully parsed" );
+    m_fills6.clear();
 }
 
 
@@ -126,6 +126,16 @@ private:
     const ARULE6* GetRule( ALTIUM_RULE_KIND aKind, const wxString& aName ) const;
     const ARULE6* GetRuleDefault( ALTIUM_RULE_KIND aKind ) const;
 
+    /**
+     * Decode the records of the large primitive streams concurrently, ahead of the conversion.
+     *
+     * Decoding only reads the compound file, so the streams do not depend on each other.  The
+     * conversion still runs stream after stream in Parse() order, as it needs the nets,
+     * components and polygons converted before.  Decoding errors are rethrown in stream order.
+     */
+    void DecodePrimitiveStreams( const ALTIUM_COMPOUND_FILE&                  aAltiumPcbFile,
+                                 const std::map<ALTIUM_PCB_DIR, std::string>& aFileMapping );
+
     void ParseFileHeader( const ALTIUM_COMPOUND_FILE&     aAltiumPcbFile,
                           const CFB::COMPOUND_FILE_ENTRY* aEntry );
 
@@ -252,6 +262,15 @@ private:
 
     std::map<ALTIUM_LAYER, ZONE*>        m_outer_plane;
 
+    /// Primitive records decoded by DecodePrimitiveStreams(), consumed by the Parse*Data()
+    std::vector<AARC6>                   m_arcs6;
+    std::vector<APAD6>                   m_pads6;
+    std::vector<AVIA6>                   m_vias6;
+    std::vector<ATRACK6>                 m_tracks6;
+    std::vector<AFILL6>                  m_fills6;
+    std::vector<AREGION6>                m_regions6;
+    std::vector<AREGION6>                m_shapeBasedRegions6;
+
     PROGRESS_REPORTER* m_progressReporter;   ///< optional; may be nullptr
     unsigned           m_doneCount;
     unsigned           m_lastProgressCount;
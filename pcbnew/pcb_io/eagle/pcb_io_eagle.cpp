@@ -1084,7 +1084,7 @@ void PCB_IO_EAGLE::loadPlain( wxXmlNode* aGraphics )
         }
 
         // Get next graphic
-        gr = gr->GetNext();
+        gr = ReleaseXmlNode( gr );
     }
 
     m_xpath->pop();
@@ -1142,7 +1142,7 @@ void PCB_IO_EAGLE::loadLibrary( wxXmlNode* aLib, const wxString* aLibName )
 
         m_xpath->pop();
 
-        package = package->GetNext();
+        package = ReleaseXmlNode( package );
     }
 
     m_xpath->pop();     // "packages"
@@ -1165,7 +1165,7 @@ void PCB_IO_EAGLE::loadLibraries( wxXmlNode* aLibs )
 
         m_xpath->Value( lib_name.c_str() );
         loadLibrary( library, &lib_name );
-        library = library->GetNext();
+        library = ReleaseXmlNode( library );
     }
 
     m_xpath->pop();
@@ -1194,7 +1194,7 @@ void PCB_IO_EAGLE::loadElements( wxXmlNode* aElements )
         if( element->GetName() != wxT( "element" ) )
         {
             // Get next item
-            element = element->GetNext();
+            element = ReleaseXmlNode( element );
             continue;
         }
 
@@ -1427,7 +1427,7 @@ void PCB_IO_EAGLE::loadElements( wxXmlNode* aElements )
         orientFootprintAndText( footprint, e, nameAttr, valueAttr );
 
         // Get next element
-        element = element->GetNext();
+        element = ReleaseXmlNode( element );
     }
 
     m_xpath->pop();     // "elements.element"
@@ -2858,7 +2858,7 @@ void PCB_IO_EAGLE::loadSignals( wxXmlNode* aSignals )
         }
 
         // Get next signal
-        net = net->GetNext();
+        net = ReleaseXmlNode( net );
     }
 
     m_xpath->pop();     // "signals.signal"
@@ -22,9 +22,13 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
+#include <fstream>
+#include <nlohmann/json.hpp>
+
 #include <advanced_config.h>
 #include <board.h>
 #include <board_design_settings.h>
+#include <cache_file.h>
 #include <confirm.h>
 #include <convert_basic_shapes_to_polygon.h> // for enum RECT_CHAMFER_POSITIONS definition
 #include <string_utils.h>
@@ -71,12 +75,65 @@
 using namespace PCB_KEYS_T;
 
 
+///< Bump this whenever the content of the footprint library index files changes
+static const int FP_CACHE_INDEX_VERSION = 1;
+
+
 FP_CACHE_ITEM::FP_CACHE_ITEM( FOOTPRINT* aFootprint, const WX_FILENAME& aFileName ) :
         m_filename( aFileName ),
         m_footprint( aFootprint )
 { }
 
 
+FP_CACHE_ITEM::FP_CACHE_ITEM( const WX_FILENAME& aFileName ) :
+        m_filename( aFileName )
+{ }
+
+
+const FOOTPRINT* FP_CACHE_ITEM::GetFootprint() const
+{
+    if( !m_footprint )
+    {
+        FILE_LINE_READER          reader( m_filename.GetFullPath() );
+        PCB_IO_KICAD_SEXPR_PARSER parser( &reader, nullptr, nullptr );
+
+        std::unique_ptr<BOARD_ITEM> item( parser.Parse() );
+        FOOTPRINT*                  footprint = dynamic_cast<FOOTPRINT*>( item.get() );
+
+        if( !footprint )
+        {
+            THROW_IO_ERROR( wxString::Format( _( "Unable to read file '%s'" ),
+                                              m_filename.GetFullPath() ) );
+        }
+
+        item.release();
+        footprint->SetFPID( LIB_ID( wxEmptyString, m_filename.GetName() ) );
+        m_footprint.reset( footprint );
+    }
+
+    return m_footprint.get();
+}
+
+
+const FOOTPRINT_METADATA& FP_CACHE_ITEM::GetMetadata() const
+{
+    if( !m_metadata )
+    {
+        const FOOTPRINT*   footprint = GetFootprint();
+        FOOTPRINT_METADATA metadata;
+
+        metadata.m_Description = footprint->GetLibDescription();
+        metadata.m_Keywords = footprint->GetKeywords();
+        metadata.m_PadCount = footprint->GetPadCount( DO_NOT_INCLUDE_NPTH );
+        metadata.m_UniquePadCount = footprint->GetUniquePadCount( DO_NOT_INCLUDE_NPTH );
+
+        m_metadata = metadata;
+    }
+
+    return *m_metadata;
+}
+
+
 FP_CACHE::FP_CACHE( PCB_IO_KICAD_SEXPR* aOwner, const wxString& aLibraryPath )
 {
     m_owner = aOwner;
@@ -84,6 +141,7 @@ FP_CACHE::FP_CACHE( PCB_IO_KICAD_SEXPR* aOwner, const wxString& aLibraryPath )
     m_lib_path.SetPath( aLibraryPath );
     m_cache_timestamp = 0;
     m_cache_dirty = true;
+    m_missing_metadata = 0;
 }
 
 
@@ -105,7 +163,8 @@ void FP_CACHE::Save( FOOTPRINT* aFootprint )
 
     for( FP_CACHE_FOOTPRINT_MAP::iterator it = m_footprints.begin(); it != m_footprints.end(); ++it )
     {
-        if( aFootprint && aFootprint != it->second->GetFootprint() )
+        // Don't parse footprints which have never been loaded just to compare them.
+        if( aFootprint && aFootprint != it->second->GetLoadedFootprint() )
             continue;
 
         WX_FILENAME fn = it->second->GetFileName();
@@ -161,6 +220,7 @@ void FP_CACHE::Load()
 {
     m_cache_dirty = false;
     m_cache_timestamp = 0;
+    m_missing_metadata = 0;
 
     wxDir dir( m_lib_raw_path );
 
@@ -178,46 +238,153 @@ void FP_CACHE::Load()
     // the filename thereafter.
     WX_FILENAME fn( m_lib_raw_path, wxT( "dummyName" ) );
 
+    // Only create stubs here: footprints are parsed when they are first requested, so
+    // enumerating a large library doesn't have to read every file.
     if( dir.GetFirst( &fullName, fileSpec ) )
     {
-        wxString cacheError;
-
         do
         {
             fn.SetFullName( fullName );
 
-            // Queue I/O errors so only files that fail to parse don't get loaded.
-            try
-            {
-                FILE_LINE_READER reader( fn.GetFullPath() );
-                PCB_IO_KICAD_SEXPR_PARSER       parser( &reader, nullptr, nullptr );
+            wxString fpName = fn.GetName();
+            m_footprints.insert( fpName, new FP_CACHE_ITEM( fn ) );
+        } while( dir.GetNext( &fullName ) );
 
-                FOOTPRINT* footprint = dynamic_cast<FOOTPRINT*>( parser.Parse() );
-                wxString fpName = fn.GetName();
+        m_cache_timestamp = GetTimestamp( m_lib_raw_path );
+    }
 
-                if( !footprint )
-                {
-                    THROW_IO_ERROR( wxString::Format( _( "Unable to read file '%s'" ),
-                                                      fn.GetFullPath() ) );
-                }
+    m_missing_metadata = (int) m_footprints.size();
 
-                footprint->SetFPID( LIB_ID( wxEmptyString, fpName ) );
-                m_footprints.insert( fpName, new FP_CACHE_ITEM( footprint, fn ) );
-            }
-            catch( const IO_ERROR& ioe )
-            {
-                if( !cacheError.IsEmpty() )
-                    cacheError += wxT( "\n\n" );
+    if( m_missing_metadata > 0 )
+        readIndex();
+}
 
-                cacheError += ioe.What();
-            }
-        } while( dir.GetNext( &fullName ) );
 
-        m_cache_timestamp = GetTimestamp( m_lib_raw_path );
+bool FP_CACHE::GetMetadata( const wxString& aFootprintName, FOOTPRINT_METADATA& aMetadata )
+{
+    FP_CACHE_FOOTPRINT_MAP::const_iterator it = m_footprints.find( aFootprintName );
+
+    if( it == m_footprints.end() )
+        return false;
+
+    if( it->second->HasMetadata() )
+    {
+        aMetadata = it->second->GetMetadata();
+        return true;
+    }
+
+    try
+    {
+        aMetadata = it->second->GetMetadata();
+    }
+    catch( const IO_ERROR& )
+    {
+        // A broken footprint must not keep the rest of the library from being indexed
+        if( --m_missing_metadata <= 0 )
+            writeIndex();
+
+        throw;
+    }
+
+    // Rewrite the index once the last footprint missing from it has been parsed
+    if( --m_missing_metadata <= 0 )
+        writeIndex();
+
+    return true;
+}
+
+
+wxString FP_CACHE::indexFileName() const
+{
+    // The full library path is stored in the index and checked when reading it back
+    return CACHE_FILE::GetPath( wxT( "footprint_index" ), m_lib_raw_path, wxT( "json" ) );
+}
+
 
-        if( !cacheError.IsEmpty() )
-            THROW_IO_ERROR( cacheError );
+void FP_CACHE::readIndex()
+{
+    std::ifstream stream( indexFileName().fn_str() );
+
+    if( !stream.is_open() )
+        return;
+
+    std::vector<std::pair<FP_CACHE_ITEM*, FOOTPRINT_METADATA>> found;
+
+    try
+    {
+        nlohmann::json index;
+
+        stream >> index;
+
+        if( index.at( "version" ).get<int>() != FP_CACHE_INDEX_VERSION
+                || wxString::FromUTF8( index.at( "path" ).get<std::string>() ) != m_lib_raw_path
+                || index.at( "timestamp" ).get<long long>() != m_cache_timestamp )
+        {
+            return;
+        }
+
+        for( const nlohmann::json& entry : index.at( "footprints" ) )
+        {
+            wxString name = wxString::FromUTF8( entry.at( "name" ).get<std::string>() );
+            FP_CACHE_FOOTPRINT_MAP::iterator it = m_footprints.find( name );
+
+            if( it == m_footprints.end() )
+                continue;
+
+            FOOTPRINT_METADATA metadata;
+
+            metadata.m_Description =
+                    wxString::FromUTF8( entry.at( "description" ).get<std::string>() );
+            metadata.m_Keywords = wxString::FromUTF8( entry.at( "keywords" ).get<std::string>() );
+            metadata.m_PadCount = entry.at( "pads" ).get<unsigned>();
+            metadata.m_UniquePadCount = entry.at( "unique_pads" ).get<unsigned>();
+
+            found.emplace_back( it->second, metadata );
+        }
+    }
+    catch( ... )
+    {
+        // whatever went wrong, the footprints will just be parsed the slow way
+        return;
+    }
+
+    for( const auto& [ item, metadata ] : found )
+    {
+        if( !item->HasMetadata() )
+        {
+            item->SetMetadata( metadata );
+            m_missing_metadata--;
+        }
+    }
+}
+
+
+void FP_CACHE::writeIndex()
+{
+    nlohmann::json index;
+    nlohmann::json footprints = nlohmann::json::array();
+
+    index["version"] = FP_CACHE_INDEX_VERSION;
+    index["path"] = TO_UTF8( m_lib_raw_path );
+    index["timestamp"] = m_cache_timestamp;
+
+    for( const auto& footprint : m_footprints )
+    {
+        if( !footprint.second->HasMetadata() )
+            continue;
+
+        const FOOTPRINT_METADATA& metadata = footprint.second->GetMetadata();
+
+        footprints.push_back( { { "name", TO_UTF8( footprint.first ) },
+                                { "description", TO_UTF8( metadata.m_Description ) },
+                                { "keywords", TO_UTF8( metadata.m_Keywords ) },
+                                { "pads", metadata.m_PadCount },
+                                { "unique_pads", metadata.m_UniquePadCount } } );
     }
+
+    index["footprints"] = footprints;
+
+    CACHE_FILE::Write( indexFileName(), index.dump() );
 }
 
 
@@ -235,11 +402,39 @@ void FP_CACHE::Remove( const wxString& aFootprintName )
 
     // Remove the footprint from the cache and delete the footprint file from the library.
     wxString fullPath = it->second->GetFileName().GetFullPath();
-    m_footprints.erase( aFootprintName );
+    Erase( aFootprintName );
     wxRemoveFile( fullPath );
 }
 
 
+void FP_CACHE::Insert( const wxString& aFootprintName, FP_CACHE_ITEM* aItem )
+{
+    Erase( aFootprintName );
+
+    // A new footprint is already loaded, so its metadata is known without parsing anything
+    if( aItem->GetLoadedFootprint() )
+        aItem->GetMetadata();
+    else
+        m_missing_metadata++;
+
+    m_footprints.insert( aFootprintName, aItem );
+}
+
+
+void FP_CACHE::Erase( const wxString& aFootprintName )
+{
+    FP_CACHE_FOOTPRINT_MAP::iterator it = m_footprints.find( aFootprintName );
+
+    if( it == m_footprints.end() )
+        return;
+
+    if( !it->second->HasMetadata() )
+        m_missing_metadata--;
+
+    m_footprints.erase( it );
+}
+
+
 bool FP_CACHE::IsPath( const wxString& aPath ) const
 {
     return aPath == m_lib_raw_path;
@@ -2640,6 +2835,7 @@ const FOOTPRINT* PCB_IO_KICAD_SEXPR::getFootprint( const wxString& aLibraryPath,
     if( it == footprints.end() )
         return nullptr;
 
+    // Parse errors of the footprint file are thrown so that they reach the user
     return it->second->GetFootprint();
 }
 
@@ -2652,6 +2848,22 @@ const FOOTPRINT* PCB_IO_KICAD_SEXPR::GetEnumeratedFootprint( const wxString& aLi
 }
 
 
+bool PCB_IO_KICAD_SEXPR::GetEnumeratedFootprintMetadata( const wxString& aLibraryPath,
+                                                         const wxString& aFootprintName,
+                                                         FOOTPRINT_METADATA& aMetadata,
+                                                         const STRING_UTF8_MAP* aProperties )
+{
+    LOCALE_IO   toggle;     // toggles on, then off, the C locale.
+
+    init( aProperties );
+
+    validateCache( aLibraryPath, false );
+
+    // Parse errors are thrown so that they are reported along with the other library errors.
+    return m_cache->GetMetadata( aFootprintName, aMetadata );
+}
+
+
 bool PCB_IO_KICAD_SEXPR::FootprintExists( const wxString& aLibraryPath, const wxString& aFootprintName,
                                   const STRING_UTF8_MAP* aProperties )
 {
@@ -2770,12 +2982,11 @@ void PCB_IO_KICAD_SEXPR::FootprintSave( const wxString& aLibraryPath, const FOOT
 
     wxString fullPath = fn.GetFullPath();
     wxString fullName = fn.GetFullName();
-    FP_CACHE_FOOTPRINT_MAP::const_iterator it = footprints.find( footprintName );
 
-    if( it != footprints.end() )
+    if( footprints.find( footprintName ) != footprints.end() )
     {
         wxLogTrace( traceKicadPcbPlugin, wxT( "Removing footprint file '%s'." ), fullPath );
-        footprints.erase( footprintName );
+        m_cache->Erase( footprintName );
         wxRemoveFile( fullPath );
     }
 
@@ -2800,8 +3011,8 @@ void PCB_IO_KICAD_SEXPR::FootprintSave( const wxString& aLibraryPath, const FOOT
     footprint->SetParentGroup( nullptr );
 
     wxLogTrace( traceKicadPcbPlugin, wxT( "Creating s-expr footprint file '%s'." ), fullPath );
-    footprints.insert( footprintName,
-                       new FP_CACHE_ITEM( footprint, WX_FILENAME( fn.GetPath(), fullName ) ) );
+    m_cache->Insert( footprintName,
+                     new FP_CACHE_ITEM( footprint, WX_FILENAME( fn.GetPath(), fullName ) ) );
     m_cache->Save( footprint );
 }
 
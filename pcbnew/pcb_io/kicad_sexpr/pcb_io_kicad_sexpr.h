@@ -29,6 +29,8 @@
 #include <pcb_io/pcb_io_mgr.h>
 
 #include <richio.h>
+#include <memory>
+#include <optional>
 #include <string>
 #include <layer_ids.h>
 #include <boost/ptr_container/ptr_map.hpp>
@@ -196,15 +198,43 @@ class PCB_IO_KICAD_SEXPR;   // forward decl
  */
 class FP_CACHE_ITEM
 {
-    WX_FILENAME                m_filename;
-    std::unique_ptr<FOOTPRINT> m_footprint;
+    WX_FILENAME                                m_filename;
+    mutable std::unique_ptr<FOOTPRINT>         m_footprint;   ///< Parsed on first use
+    mutable std::optional<FOOTPRINT_METADATA>  m_metadata;
 
 public:
     FP_CACHE_ITEM( FOOTPRINT* aFootprint, const WX_FILENAME& aFileName );
 
+    /**
+     * Create a stub for a footprint file which is not parsed until the footprint is needed.
+     */
+    FP_CACHE_ITEM( const WX_FILENAME& aFileName );
+
     const WX_FILENAME& GetFileName() const { return m_filename; }
     void               SetFilePath( const wxString& aFilePath ) { m_filename.SetPath( aFilePath ); }
-    const FOOTPRINT*   GetFootprint() const { return m_footprint.get(); }
+
+    /**
+     * Return the footprint, parsing its file first if it has not been loaded yet.
+     *
+     * @throw IO_ERROR if the footprint file cannot be read or parsed.
+     */
+    const FOOTPRINT* GetFootprint() const;
+
+    /**
+     * Return the footprint only if it has already been loaded, nullptr otherwise.
+     */
+    const FOOTPRINT* GetLoadedFootprint() const { return m_footprint.get(); }
+
+    bool HasMetadata() const { return m_metadata.has_value(); }
+
+    /**
+     * Return the chooser metadata, loading the footprint if it is not already known.
+     *
+     * @throw IO_ERROR if the footprint file cannot be read or parsed.
+     */
+    const FOOTPRINT_METADATA& GetMetadata() const;
+
+    void SetMetadata( const FOOTPRINT_METADATA& aMetadata ) { m_metadata = aMetadata; }
 };
 
 typedef boost::ptr_map<wxString, FP_CACHE_ITEM> FP_CACHE_FOOTPRINT_MAP;
@@ -221,6 +251,8 @@ class FP_CACHE
     long long m_cache_timestamp; // A hash of the timestamps for all the footprint
                                  // files.
 
+    int m_missing_metadata;      // Number of footprints whose metadata is not yet known.
+
 public:
     FP_CACHE( PCB_IO_KICAD_SEXPR* aOwner, const wxString& aLibraryPath );
 
@@ -243,10 +275,39 @@ public:
      */
     void Save( FOOTPRINT* aFootprint = nullptr );
 
+    /**
+     * Enumerate the footprint files of the library.
+     *
+     * The footprints themselves are only parsed when first requested.  Their metadata is
+     * read from the library index when it is up to date.
+     */
     void Load();
 
     void Remove( const wxString& aFootprintName );
 
+    /**
+     * Add \a aItem to the cache, replacing the footprint of the same name if there is one.
+     *
+     * The cache takes ownership of \a aItem.
+     */
+    void Insert( const wxString& aFootprintName, FP_CACHE_ITEM* aItem );
+
+    /**
+     * Drop a footprint from the cache without touching the library files.
+     */
+    void Erase( const wxString& aFootprintName );
+
+    /**
+     * Fetch the chooser metadata of a footprint.
+     *
+     * Once the metadata of every footprint is known, the library index is rewritten so that
+     * the next session does not have to parse the library again.
+     *
+     * @return false if the library has no footprint \a aFootprintName.
+     * @throw IO_ERROR if the footprint has to be parsed and cannot be.
+     */
+    bool GetMetadata( const wxString& aFootprintName, FOOTPRINT_METADATA& aMetadata );
+
     /**
      * Generate a timestamp representing all source files in the cache (including the
      * parent directory).
@@ -273,6 +334,18 @@ public:
     bool IsPath( const wxString& aPath ) const;
 
     void SetPath( const wxString& aPath );
+
+private:
+    /**
+     * The library index holds the metadata of every footprint of the library.  It is stored
+     * in the user cache directory and is only valid for the library timestamp it was written
+     * with.
+     */
+    wxString indexFileName() const;
+
+    void readIndex();
+
+    void writeIndex();
 };
 
 
@@ -327,6 +400,11 @@ public:
                                              const wxString& aFootprintName,
                                              const STRING_UTF8_MAP* aProperties = nullptr ) override;
 
+    bool GetEnumeratedFootprintMetadata( const wxString& aLibraryPath,
+                                         const wxString& aFootprintName,
+                                         FOOTPRINT_METADATA& aMetadata,
+                                         const STRING_UTF8_MAP* aProperties = nullptr ) override;
+
     bool FootprintExists( const wxString& aLibraryPath, const wxString& aFootprintName,
                           const STRING_UTF8_MAP* aProperties = nullptr ) override;
 
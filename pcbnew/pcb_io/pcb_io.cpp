@@ -23,6 +23,7 @@
  */
 
 #include <unordered_set>
+#include <footprint.h>
 #include <pcb_io/pcb_io.h>
 #include <pcb_io/pcb_io_mgr.h>
 #include <ki_exception.h>
@@ -137,6 +138,26 @@ const FOOTPRINT* PCB_IO::GetEnumeratedFootprint( const wxString& aLibraryPath,
 }
 
 
+bool PCB_IO::GetEnumeratedFootprintMetadata( const wxString& aLibraryPath,
+                                             const wxString& aFootprintName,
+                                             FOOTPRINT_METADATA& aMetadata,
+                                             const STRING_UTF8_MAP* aProperties )
+{
+    // default implementation
+    const FOOTPRINT* footprint = GetEnumeratedFootprint( aLibraryPath, aFootprintName,
+                                                         aProperties );
+
+    if( !footprint )
+        return false;
+
+    aMetadata.m_Description = footprint->GetLibDescription();
+    aMetadata.m_Keywords = footprint->GetKeywords();
+    aMetadata.m_PadCount = footprint->GetPadCount( DO_NOT_INCLUDE_NPTH );
+    aMetadata.m_UniquePadCount = footprint->GetUniquePadCount( DO_NOT_INCLUDE_NPTH );
+    return true;
+}
+
+
 bool PCB_IO::FootprintExists( const wxString& aLibraryPath, const wxString& aFootprintName,
                               const STRING_UTF8_MAP* aProperties )
 {
@@ -40,6 +40,19 @@ class STRING_UTF8_MAP;
 class PROJECT;
 class PROGRESS_REPORTER;
 
+
+/**
+ * The footprint chooser metadata of a library footprint.
+ */
+struct FOOTPRINT_METADATA
+{
+    wxString m_Description;
+    wxString m_Keywords;
+    unsigned m_PadCount = 0;        ///< Pad count, not including NPTH pads
+    unsigned m_UniquePadCount = 0;  ///< Unique pad numbers count, not including NPTH pads
+};
+
+
 /**
  * A base class that #BOARD loading and saving plugins should derive from.
  *
@@ -259,6 +272,19 @@ public:
                                                      const wxString& aFootprintName,
                                                      const STRING_UTF8_MAP* aProperties = nullptr );
 
+    /**
+     * Fetch the chooser metadata of a footprint after FootprintEnumerate().
+     *
+     * Plugins able to provide the metadata without instantiating the whole footprint should
+     * override this.  The default implementation uses GetEnumeratedFootprint().
+     *
+     * @return false if the footprint cannot be found or read.
+     */
+    virtual bool GetEnumeratedFootprintMetadata( const wxString& aLibraryPath,
+                                                 const wxString& aFootprintName,
+                                                 FOOTPRINT_METADATA& aMetadata,
+                                                 const STRING_UTF8_MAP* aProperties = nullptr );
+
     /**
      * Check for the existence of a footprint.
      */
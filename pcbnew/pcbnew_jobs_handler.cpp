@@ -37,6 +37,7 @@
 #include <jobs/job_export_pcb_pos.h>
 #include <jobs/job_export_pcb_svg.h>
 #include <jobs/job_export_pcb_3d.h>
+#include <jobs/job_pcb_convert.h>
 #include <jobs/job_pcb_drc.h>
 #include <cli/exit_codes.h>
 #include <exporters/place_file_exporter.h>
@@ -94,6 +95,8 @@ PCBNEW_JOBS_HANDLER::PCBNEW_JOBS_HANDLER( KIWAY* aKiway ) :
     Register( "drc", std::bind( &PCBNEW_JOBS_HANDLER::JobExportDrc, this, std::placeholders::_1 ) );
     Register( "ipc2581",
               std::bind( &PCBNEW_JOBS_HANDLER::JobExportIpc2581, this, std::placeholders::_1 ) );
+    Register( "pcbconvert",
+              std::bind( &PCBNEW_JOBS_HANDLER::JobConvert, this, std::placeholders::_1 ) );
 }
 
 
@@ -770,9 +773,21 @@ int PCBNEW_JOBS_HANDLER::JobExportFpUpgrade( JOB* aJob )
     PCB_IO_KICAD_SEXPR  pcb_io( CTL_FOR_LIBRARY );
     FP_CACHE   fpLib( &pcb_io, upgradeJob->m_libraryPath );
 
+    bool shouldSave = upgradeJob->m_force;
+
     try
     {
         fpLib.Load();
+
+        // The cache parses footprints on demand, so read errors show up here
+        for( const auto& footprint : fpLib.GetFootprints() )
+        {
+            if( footprint.second->GetFootprint()->GetFileFormatVersionAtLoad()
+                    < SEXPR_BOARD_FILE_VERSION )
+            {
+                shouldSave = true;
+            }
+        }
     }
     catch(...)
     {
@@ -780,16 +795,6 @@ int PCBNEW_JOBS_HANDLER::JobExportFpUpgrade( JOB* aJob )
         return CLI::EXIT_CODES::ERR_UNKNOWN;
     }
 
-    bool shouldSave = upgradeJob->m_force;
-
-    for( const auto& footprint : fpLib.GetFootprints() )
-    {
-        if( footprint.second->GetFootprint()->GetFileFormatVersionAtLoad() < SEXPR_BOARD_FILE_VERSION )
-        {
-            shouldSave = true;
-        }
-    }
-
     if( shouldSave )
     {
         m_reporter->Report( _( "Saving footprint library\n" ), RPT_SEVERITY_INFO );
@@ -855,10 +860,10 @@ int PCBNEW_JOBS_HANDLER::JobExportFpSvg( JOB* aJob )
     for( FP_CACHE_FOOTPRINT_MAP::iterator it = footprintMap.begin(); it != footprintMap.end();
          ++it )
     {
-        const FOOTPRINT* fp = it->second->GetFootprint();
         if( !svgJob->m_footprint.IsEmpty() )
         {
-            if( fp->GetFPID().GetLibItemName().wx_str() != svgJob->m_footprint )
+            // The cache is keyed by footprint name, so skip without parsing the footprint
+            if( it->first != svgJob->m_footprint )
             {
                 // skip until we find the right footprint
                 continue;
@@ -869,6 +874,19 @@ int PCBNEW_JOBS_HANDLER::JobExportFpSvg( JOB* aJob )
             }
         }
 
+        const FOOTPRINT* fp = nullptr;
+
+        try
+        {
+            fp = it->second->GetFootprint();
+        }
+        catch( const IO_ERROR& ioe )
+        {
+            m_reporter->Report( ioe.What() + wxS( "\n" ), RPT_SEVERITY_ERROR );
+            exitCode = CLI::EXIT_CODES::ERR_UNKNOWN;
+            break;
+        }
+
         exitCode = doFpExportSvg( svgJob, fp );
         if( exitCode != CLI::EXIT_CODES::OK )
             break;
@@ -1193,6 +1211,83 @@ int PCBNEW_JOBS_HANDLER::JobExportIpc2581( JOB* aJob )
 }
 
 
+int PCBNEW_JOBS_HANDLER::JobConvert( JOB* aJob )
+{
+    JOB_PCB_CONVERT* convertJob = dynamic_cast<JOB_PCB_CONVERT*>( aJob );
+
+    if( convertJob == nullptr )
+        return CLI::EXIT_CODES::ERR_UNKNOWN;
+
+    PCB_IO_MGR::PCB_FILE_T fileType = PCB_IO_MGR::FILE_TYPE_NONE;
+
+    if( convertJob->m_format.IsEmpty() )
+        fileType = PCB_IO_MGR::FindPluginTypeFromBoardPath( convertJob->m_filename );
+    else
+        fileType = PCB_IO_MGR::EnumFromStr( convertJob->m_format );
+
+    if( fileType == PCB_IO_MGR::FILE_TYPE_NONE || fileType == PCB_IO_MGR::PCB_FILE_T( -1 ) )
+    {
+        m_reporter->Report( wxString::Format( _( "No importer can read '%s'\n" ),
+                                              convertJob->m_filename ),
+                            RPT_SEVERITY_ERROR );
+        return CLI::EXIT_CODES::ERR_INVALID_INPUT_FILE;
+    }
+
+    if( convertJob->m_outputFile.IsEmpty() )
+    {
+        wxFileName fn = convertJob->m_filename;
+        fn.SetExt( FILEEXT::KiCadPcbFileExtension );
+
+        convertJob->m_outputFile = fn.GetFullPath();
+    }
+
+    if( aJob->IsCli() )
+    {
+        m_reporter->Report( wxString::Format( _( "Loading board with the %s importer\n" ),
+                                              PCB_IO_MGR::ShowType( fileType ) ),
+                            RPT_SEVERITY_INFO );
+    }
+
+    BOARD* brd = nullptr;
+
+    try
+    {
+        brd = LoadBoard( convertJob->m_filename, fileType, true );
+    }
+    catch( const IO_ERROR& ioe )
+    {
+        m_reporter->Report( wxString::Format( _( "Error loading board '%s'.\n%s\n" ),
+                                              convertJob->m_filename, ioe.What() ),
+                            RPT_SEVERITY_ERROR );
+        return CLI::EXIT_CODES::ERR_INVALID_INPUT_FILE;
+    }
+
+    if( !brd )
+    {
+        m_reporter->Report( wxString::Format( _( "Error loading board '%s'.\n" ),
+                                              convertJob->m_filename ),
+                            RPT_SEVERITY_ERROR );
+        return CLI::EXIT_CODES::ERR_INVALID_INPUT_FILE;
+    }
+
+    brd->SetFileName( convertJob->m_outputFile );
+
+    // The project file is left alone: a batch may convert several designs into one folder
+    if( !SaveBoard( convertJob->m_outputFile, brd, true ) )
+    {
+        m_reporter->Report( wxString::Format( _( "Error saving board '%s'.\n" ),
+                                              convertJob->m_outputFile ),
+                            RPT_SEVERITY_ERROR );
+        return CLI::EXIT_CODES::ERR_UNKNOWN;
+    }
+
+    m_reporter->Report( wxString::Format( _( "Saved board to '%s'\n" ), convertJob->m_outputFile ),
+                        RPT_SEVERITY_ACTION );
+
+    return CLI::EXIT_CODES::SUCCESS;
+}
+
+
 DS_PROXY_VIEW_ITEM* PCBNEW_JOBS_HANDLER::getDrawingSheetProxyView( BOARD* aBrd )
 {
     DS_PROXY_VIEW_ITEM* drawingSheet = new DS_PROXY_VIEW_ITEM( pcbIUScale,
@@ -34,9 +34,15 @@
 
 #include <action_plugin.h>
 #include <board.h>
+#include <board_commit.h>
 #include <board_design_settings.h>
+#include <footprint.h>
+#include <pad.h>
+#include <pcb_edit_frame.h>
+#include <pcb_track.h>
 #include <pcb_marker.h>
 #include <cstdlib>
+#include <functional>
 #include <drawing_sheet/ds_data_model.h>
 #include <drc/drc_engine.h>
 #include <drc/drc_item.h>
@@ -661,3 +667,310 @@ wxString GetLanguage()
     else
         return "";
 }
+
+
+BULK_DATA GetBulkTrackData( BOARD* aBoard )
+{
+    BULK_DATA data;
+
+    data.reserve( aBoard->Tracks().size() * BULK_TRACK_FIELD_COUNT );
+
+    for( PCB_TRACK* track : aBoard->Tracks() )
+    {
+        if( track->Type() != PCB_TRACE_T && track->Type() != PCB_ARC_T )
+            continue;
+
+        VECTOR2I mid = ( track->GetStart() + track->GetEnd() ) / 2;
+
+        if( track->Type() == PCB_ARC_T )
+            mid = static_cast<PCB_ARC*>( track )->GetMid();
+
+        data.insert( data.end(), { (double) track->GetStart().x, (double) track->GetStart().y,
+                                   (double) track->GetEnd().x, (double) track->GetEnd().y,
+                                   (double) mid.x, (double) mid.y, (double) track->GetWidth(),
+                                   (double) track->GetLayer(), (double) track->GetNetCode() } );
+    }
+
+    return data;
+}
+
+
+BULK_DATA GetBulkViaData( BOARD* aBoard )
+{
+    BULK_DATA data;
+
+    for( PCB_TRACK* track : aBoard->Tracks() )
+    {
+        if( track->Type() != PCB_VIA_T )
+            continue;
+
+        PCB_VIA*     via = static_cast<PCB_VIA*>( track );
+        PCB_LAYER_ID top;
+        PCB_LAYER_ID bottom;
+
+        via->LayerPair( &top, &bottom );
+
+        data.insert( data.end(), { (double) via->GetPosition().x, (double) via->GetPosition().y,
+                                   (double) via->GetWidth(), (double) via->GetDrillValue(),
+                                   (double) top, (double) bottom, (double) via->GetNetCode(),
+                                   (double) via->GetViaType() } );
+    }
+
+    return data;
+}
+
+
+BULK_DATA GetBulkPadData( BOARD* aBoard )
+{
+    BULK_DATA data;
+    size_t    footprintRow = 0;
+
+    for( FOOTPRINT* footprint : aBoard->Footprints() )
+    {
+        for( PAD* pad : footprint->Pads() )
+        {
+            data.insert( data.end(), { (double) pad->GetPosition().x,
+                                       (double) pad->GetPosition().y,
+                                       (double) pad->GetSize().x, (double) pad->GetSize().y,
+                                       pad->GetOrientation().AsDegrees(),
+                                       (double) pad->GetNetCode(), (double) footprintRow } );
+        }
+
+        footprintRow++;
+    }
+
+    return data;
+}
+
+
+BULK_DATA GetBulkFootprintData( BOARD* aBoard )
+{
+    BULK_DATA data;
+
+    data.reserve( aBoard->Footprints().size() * BULK_FOOTPRINT_FIELD_COUNT );
+
+    for( FOOTPRINT* footprint : aBoard->Footprints() )
+    {
+        data.insert( data.end(), { (double) footprint->GetPosition().x,
+                                   (double) footprint->GetPosition().y,
+                                   footprint->GetOrientation().AsDegrees(),
+                                   footprint->IsFlipped() ? 1.0 : 0.0,
+                                   footprint->IsLocked() ? 1.0 : 0.0 } );
+    }
+
+    return data;
+}
+
+
+/**
+ * Apply \a aUpdate to the items of \a aItems for which \a aNeedsUpdate is true.
+ *
+ * On the board open in the editor all the changes go through one BOARD_COMMIT, so they are
+ * a single undo step and the view, connectivity and ratsnest are updated once.  An action
+ * plugin is already wrapped in a commit by the editor, and a standalone board has no editor:
+ * in both cases the items are modified directly.
+ */
+static void applyBulkData( BOARD* aBoard, const std::vector<BOARD_ITEM*>& aItems,
+                           const std::function<bool( size_t )>& aNeedsUpdate,
+                           const std::function<void( size_t )>& aUpdate )
+{
+    if( s_PcbEditFrame && s_PcbEditFrame->GetBoard() == aBoard && !IsActionRunning() )
+    {
+        BOARD_COMMIT commit( s_PcbEditFrame );
+
+        for( size_t row = 0; row < aItems.size(); ++row )
+        {
+            if( aNeedsUpdate( row ) )
+            {
+                commit.Modify( aItems[row] );
+                aUpdate( row );
+            }
+        }
+
+        if( !commit.Empty() )
+            commit.Push( _( "Script Bulk Update" ) );
+    }
+    else
+    {
+        for( size_t row = 0; row < aItems.size(); ++row )
+        {
+            if( aNeedsUpdate( row ) )
+                aUpdate( row );
+        }
+    }
+}
+
+
+bool SetBulkTrackData( BOARD* aBoard, const BULK_DATA& aData )
+{
+    std::vector<BOARD_ITEM*> tracks;
+
+    for( PCB_TRACK* track : aBoard->Tracks() )
+    {
+        if( track->Type() == PCB_TRACE_T || track->Type() == PCB_ARC_T )
+            tracks.push_back( track );
+    }
+
+    if( aData.size() != tracks.size() * BULK_TRACK_FIELD_COUNT )
+        return false;
+
+    auto field =
+            [&]( size_t aRow, int aField ) -> int
+            {
+                return KiROUND( aData[aRow * BULK_TRACK_FIELD_COUNT + aField] );
+            };
+
+    auto needsUpdate =
+            [&]( size_t aRow ) -> bool
+            {
+                PCB_TRACK* track = static_cast<PCB_TRACK*>( tracks[aRow] );
+
+                if( track->GetStart() != VECTOR2I( field( aRow, BULK_TRACK_START_X ),
+                                                   field( aRow, BULK_TRACK_START_Y ) )
+                    || track->GetEnd() != VECTOR2I( field( aRow, BULK_TRACK_END_X ),
+                                                     field( aRow, BULK_TRACK_END_Y ) )
+                    || track->GetWidth() != field( aRow, BULK_TRACK_WIDTH ) )
+                {
+                    return true;
+                }
+
+                return track->Type() == PCB_ARC_T
+                       && static_cast<PCB_ARC*>( track )->GetMid()
+                                  != VECTOR2I( field( aRow, BULK_TRACK_MID_X ),
+                                               field( aRow, BULK_TRACK_MID_Y ) );
+            };
+
+    applyBulkData( aBoard, tracks, needsUpdate,
+            [&]( size_t aRow )
+            {
+                PCB_TRACK* track = static_cast<PCB_TRACK*>( tracks[aRow] );
+
+                track->SetStart( VECTOR2I( field( aRow, BULK_TRACK_START_X ),
+                                           field( aRow, BULK_TRACK_START_Y ) ) );
+                track->SetEnd( VECTOR2I( field( aRow, BULK_TRACK_END_X ),
+                                         field( aRow, BULK_TRACK_END_Y ) ) );
+                track->SetWidth( field( aRow, BULK_TRACK_WIDTH ) );
+
+                if( track->Type() == PCB_ARC_T )
+                {
+                    PCB_ARC* arc = static_cast<PCB_ARC*>( track );
+
+                    arc->SetMid( VECTOR2I( field( aRow, BULK_TRACK_MID_X ),
+                                           field( aRow, BULK_TRACK_MID_Y ) ) );
+                }
+            } );
+
+    return true;
+}
+
+
+bool SetBulkViaData( BOARD* aBoard, const BULK_DATA& aData )
+{
+    std::vector<BOARD_ITEM*> vias;
+
+    for( PCB_TRACK* track : aBoard->Tracks() )
+    {
+        if( track->Type() == PCB_VIA_T )
+            vias.push_back( track );
+    }
+
+    if( aData.size() != vias.size() * BULK_VIA_FIELD_COUNT )
+        return false;
+
+    auto field =
+            [&]( size_t aRow, int aField ) -> int
+            {
+                return KiROUND( aData[aRow * BULK_VIA_FIELD_COUNT + aField] );
+            };
+
+    applyBulkData( aBoard, vias,
+            [&]( size_t aRow ) -> bool
+            {
+                PCB_VIA* via = static_cast<PCB_VIA*>( vias[aRow] );
+
+                return via->GetPosition() != VECTOR2I( field( aRow, BULK_VIA_X ),
+                                                       field( aRow, BULK_VIA_Y ) )
+                       || via->GetWidth() != field( aRow, BULK_VIA_WIDTH )
+                       || via->GetDrillValue() != field( aRow, BULK_VIA_DRILL );
+            },
+            [&]( size_t aRow )
+            {
+                PCB_VIA* via = static_cast<PCB_VIA*>( vias[aRow] );
+
+                via->SetPosition( VECTOR2I( field( aRow, BULK_VIA_X ),
+                                            field( aRow, BULK_VIA_Y ) ) );
+                via->SetWidth( field( aRow, BULK_VIA_WIDTH ) );
+
+                if( via->GetDrillValue() != field( aRow, BULK_VIA_DRILL ) )
+                    via->SetDrill( field( aRow, BULK_VIA_DRILL ) );
+            } );
+
+    return true;
+}
+
+
+bool SetBulkFootprintData( BOARD* aBoard, const BULK_DATA& aData )
+{
+    std::vector<BOARD_ITEM*> footprints( aBoard->Footprints().begin(),
+                                         aBoard->Footprints().end() );
+
+    if( aData.size() != footprints.size() * BULK_FOOTPRINT_FIELD_COUNT )
+        return false;
+
+    auto field =
+            [&]( size_t aRow, int aField ) -> double
+            {
+                return aData[aRow * BULK_FOOTPRINT_FIELD_COUNT + aField];
+            };
+
+    auto position =
+            [&]( size_t aRow ) -> VECTOR2I
+            {
+                return VECTOR2I( KiROUND( field( aRow, BULK_FOOTPRINT_X ) ),
+                                 KiROUND( field( aRow, BULK_FOOTPRINT_Y ) ) );
+            };
+
+    auto orientation =
+            [&]( size_t aRow ) -> EDA_ANGLE
+            {
+                EDA_ANGLE angle( field( aRow, BULK_FOOTPRINT_ORIENTATION ), DEGREES_T );
+                return angle.Normalize180();
+            };
+
+    auto backSide =
+            [&]( size_t aRow ) -> bool
+            {
+                return field( aRow, BULK_FOOTPRINT_BACK_SIDE ) != 0.0;
+            };
+
+    auto locked =
+            [&]( size_t aRow ) -> bool
+            {
+                return field( aRow, BULK_FOOTPRINT_LOCKED ) != 0.0;
+            };
+
+    applyBulkData( aBoard, footprints,
+            [&]( size_t aRow ) -> bool
+            {
+                FOOTPRINT* footprint = static_cast<FOOTPRINT*>( footprints[aRow] );
+
+                return footprint->GetPosition() != position( aRow )
+                       || footprint->GetOrientation() != orientation( aRow )
+                       || footprint->IsFlipped() != backSide( aRow )
+                       || footprint->IsLocked() != locked( aRow );
+            },
+            [&]( size_t aRow )
+            {
+                FOOTPRINT* footprint = static_cast<FOOTPRINT*>( footprints[aRow] );
+
+                // Flip first: the flip changes the orientation, which is then set explicitly
+                if( footprint->IsFlipped() != backSide( aRow ) )
+                    footprint->Flip( footprint->GetPosition(), false );
+
+                footprint->SetOrientation( orientation( aRow ) );
+                footprint->SetPosition( position( aRow ) );
+                footprint->SetLocked( locked( aRow ) );
+            } );
+
+    return true;
+}
@@ -26,6 +26,7 @@
 #define __PCBNEW_SCRIPTING_HELPERS_H
 
 #include <deque>
+#include <vector>
 #include <pcb_io/pcb_io_mgr.h>
 #include <layer_ids.h>
 
@@ -260,4 +261,115 @@ bool WriteDRCReport( BOARD* aBoard, const wxString& aFileName, EDA_UNITS aUnits,
  */
 wxString GetLanguage();
 
+/**
+ * Board data packed for scripts working on whole boards.
+ *
+ * Each item is a row of float64 fields, laid out as given by the BULK_*_FIELDS enums below,
+ * and the rows of all the items follow each other.  The pcbnew.i typemaps hand it to Python
+ * as a single buffer, so reading a whole board does not create a Python object per item.
+ */
+typedef std::vector<double> BULK_DATA;
+
+/// Fields of a track or arc row.  For a straight track MID is the middle of the segment.
+enum BULK_TRACK_FIELDS
+{
+    BULK_TRACK_START_X = 0,
+    BULK_TRACK_START_Y,
+    BULK_TRACK_END_X,
+    BULK_TRACK_END_Y,
+    BULK_TRACK_MID_X,
+    BULK_TRACK_MID_Y,
+    BULK_TRACK_WIDTH,
+    BULK_TRACK_LAYER,
+    BULK_TRACK_NETCODE,
+    BULK_TRACK_FIELD_COUNT
+};
+
+/// Fields of a via row.
+enum BULK_VIA_FIELDS
+{
+    BULK_VIA_X = 0,
+    BULK_VIA_Y,
+    BULK_VIA_WIDTH,
+    BULK_VIA_DRILL,
+    BULK_VIA_TOP_LAYER,
+    BULK_VIA_BOTTOM_LAYER,
+    BULK_VIA_NETCODE,
+    BULK_VIA_TYPE,
+    BULK_VIA_FIELD_COUNT
+};
+
+/// Fields of a pad row.  FOOTPRINT is the row of the parent footprint in the footprint data.
+enum BULK_PAD_FIELDS
+{
+    BULK_PAD_X = 0,
+    BULK_PAD_Y,
+    BULK_PAD_SIZE_X,
+    BULK_PAD_SIZE_Y,
+    BULK_PAD_ORIENTATION,
+    BULK_PAD_NETCODE,
+    BULK_PAD_FOOTPRINT,
+    BULK_PAD_FIELD_COUNT
+};
+
+/// Fields of a footprint row.  Orientations are in degrees, flags are 0 or 1.
+enum BULK_FOOTPRINT_FIELDS
+{
+    BULK_FOOTPRINT_X = 0,
+    BULK_FOOTPRINT_Y,
+    BULK_FOOTPRINT_ORIENTATION,
+    BULK_FOOTPRINT_BACK_SIDE,
+    BULK_FOOTPRINT_LOCKED,
+    BULK_FOOTPRINT_FIELD_COUNT
+};
+
+/**
+ * Get the tracks and arcs of \a aBoard, in the order of BOARD::Tracks() (vias excluded).
+ */
+BULK_DATA GetBulkTrackData( BOARD* aBoard );
+
+/**
+ * Get the vias of \a aBoard, in the order of BOARD::Tracks().
+ */
+BULK_DATA GetBulkViaData( BOARD* aBoard );
+
+/**
+ * Get the pads of \a aBoard, footprint after footprint in the order of BOARD::Footprints().
+ */
+BULK_DATA GetBulkPadData( BOARD* aBoard );
+
+/**
+ * Get the placement of the footprints of \a aBoard, in the order of BOARD::Footprints().
+ */
+BULK_DATA GetBulkFootprintData( BOARD* aBoard );
+
+/**
+ * Update the tracks and arcs of \a aBoard from data in the GetBulkTrackData() layout.
+ *
+ * The start, end, mid and width fields are applied, the others are read only.  Only the items
+ * whose values differ are modified.  On the board open in the editor the changes are applied
+ * as a single commit (one undo step), unless an action plugin is running.
+ *
+ * @return false, without changing anything, if \a aData doesn't have one row per track.
+ */
+bool SetBulkTrackData( BOARD* aBoard, const BULK_DATA& aData );
+
+/**
+ * Update the vias of \a aBoard from data in the GetBulkViaData() layout.
+ *
+ * The position, width and drill fields are applied, the others are read only.  See
+ * SetBulkTrackData() for how the changes are committed.
+ *
+ * @return false, without changing anything, if \a aData doesn't have one row per via.
+ */
+bool SetBulkViaData( BOARD* aBoard, const BULK_DATA& aData );
+
+/**
+ * Update the placement of the footprints of \a aBoard from data in the GetBulkFootprintData()
+ * layout.  All the fields are applied; see SetBulkTrackData() for how they are committed.
+ *
+ * @return false, without changing anything, if \a aData doesn't have one row per footprint.
+ */
+bool SetBulkFootprintData( BOARD* aBoard, const BULK_DATA& aData );
+
 #endif      // __PCBNEW_SCRIPTING_HELPERS_H
@@ -153,6 +153,64 @@ HANDLE_EXCEPTIONS(BOARD::TracksInNetBetweenPoints)
     def Save(self,filename):
         return SaveBoard(filename,self)
 
+    def _BulkView(self, data, fieldCount):
+        rows = len(data) // (8 * fieldCount)
+
+        if rows == 0:
+            return memoryview(data).cast('d')
+
+        return memoryview(data).cast('d', (rows, fieldCount))
+
+    def GetTracksData(self):
+        """
+        Return the tracks and arcs (not the vias) as a float64 memoryview of shape
+        (track count, BULK_TRACK_FIELD_COUNT), indexed by the BULK_TRACK_* constants.
+        Rows follow the order of Tracks().  Use numpy.asarray() for a numpy view.
+        """
+        return self._BulkView(GetBulkTrackData(self), BULK_TRACK_FIELD_COUNT)
+
+    def GetViasData(self):
+        """
+        Return the vias as a float64 memoryview of shape (via count, BULK_VIA_FIELD_COUNT),
+        indexed by the BULK_VIA_* constants.  Rows follow the order of Tracks().
+        """
+        return self._BulkView(GetBulkViaData(self), BULK_VIA_FIELD_COUNT)
+
+    def GetPadsData(self):
+        """
+        Return the pads as a float64 memoryview of shape (pad count, BULK_PAD_FIELD_COUNT),
+        indexed by the BULK_PAD_* constants.  Rows follow Footprints() then Pads().
+        """
+        return self._BulkView(GetBulkPadData(self), BULK_PAD_FIELD_COUNT)
+
+    def GetFootprintsData(self):
+        """
+        Return the footprint placements as a float64 memoryview of shape
+        (footprint count, BULK_FOOTPRINT_FIELD_COUNT), indexed by the BULK_FOOTPRINT_*
+        constants.  Rows follow the order of Footprints().
+        """
+        return self._BulkView(GetBulkFootprintData(self), BULK_FOOTPRINT_FIELD_COUNT)
+
+    def SetTracksData(self, data):
+        """
+        Apply track geometry in the GetTracksData() layout, as a single commit in the editor.
+        """
+        return SetBulkTrackData(self, data)
+
+    def SetViasData(self, data):
+        """
+        Apply via positions and sizes in the GetViasData() layout, as a single commit in the
+        editor.
+        """
+        return SetBulkViaData(self, data)
+
+    def SetFootprintsData(self, data):
+        """
+        Apply footprint placements in the GetFootprintsData() layout, as a single commit in
+        the editor.
+        """
+        return SetBulkFootprintData(self, data)
+
     def GetNetClasses(self):
         return self.GetDesignSettings().m_NetSettings.m_NetClasses
 
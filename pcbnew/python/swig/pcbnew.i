@@ -124,6 +124,38 @@ HANDLE_EXCEPTIONS(PLUGIN::FootprintDelete)
 %include <gal/color4d.h>
 %include <id.h>
 
+// BULK_DATA is passed as a single float64 buffer rather than as a tuple of Python floats,
+// so whole boards can be read and written without a Python object per item.
+%typemap(out) BULK_DATA
+{
+    $result = PyByteArray_FromStringAndSize( reinterpret_cast<const char*>( $1.data() ),
+                                             $1.size() * sizeof( double ) );
+}
+
+%typemap(in) const BULK_DATA& (BULK_DATA temp)
+{
+    Py_buffer view;
+
+    if( PyObject_GetBuffer( $input, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT ) != 0 )
+        SWIG_fail;
+
+    // Accept float64 arrays (memoryview, array.array, numpy) as well as raw bytes
+    const char* format = view.format ? view.format : "B";
+    bool        isDouble = view.itemsize == sizeof( double ) && format[strlen( format ) - 1] == 'd';
+    bool        isBytes = view.itemsize == 1;
+
+    if( ( !isDouble && !isBytes ) || view.len % sizeof( double ) != 0 )
+    {
+        PyBuffer_Release( &view );
+        SWIG_exception_fail( SWIG_TypeError, "expected a contiguous buffer of float64 values" );
+    }
+
+    temp.resize( view.len / sizeof( double ) );
+    memcpy( temp.data(), view.buf, view.len );
+    PyBuffer_Release( &view );
+    $1 = &temp;
+}
+
 HANDLE_EXCEPTIONS(LoadBoard)
 HANDLE_EXCEPTIONS(WriteDRCReport)
 %include <pcbnew_scripting_helpers.h>
@@ -20,6 +20,7 @@
  */
 
 #include "pns_index.h"
+#include "pns_hole.h"
 #include "pns_router.h"
 
 namespace PNS {
@@ -44,6 +45,30 @@ void INDEX::Add( ITEM* aItem )
 }
 
 
+bool INDEX::batchReference( const ITEM* aItem, SEG& aSeg, int& aRadius )
+{
+    if( !aItem->OfKind( ITEM::SEGMENT_T | ITEM::VIA_T ) )
+        return false;
+
+    if( !SEG_BATCH::AsSegment( aItem->Shape(), aSeg, aRadius ) )
+        return false;
+
+    // The hole of a via being routed is not in the index, and collides on its own
+    if( const HOLE* hole = aItem->Hole() )
+    {
+        SEG holeSeg;
+        int holeRadius;
+
+        if( !SEG_BATCH::AsSegment( hole->Shape(), holeSeg, holeRadius ) || holeSeg != aSeg )
+            return false;
+
+        aRadius = std::max( aRadius, holeRadius );
+    }
+
+    return true;
+}
+
+
 void INDEX::Remove( ITEM* aItem )
 {
     const LAYER_RANGE& range = aItem->Layers();
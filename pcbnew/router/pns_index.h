@@ -28,6 +28,7 @@
 #include <unordered_set>
 
 #include <layer_ids.h>
+#include <geometry/seg_batch.h>
 #include <geometry/shape_index.h>
 
 #include "pns_item.h"
@@ -118,6 +119,14 @@ public:
     ITEM_SET::iterator end() { return m_allItems.end(); }
 
 private:
+    /**
+     * Get the segment and half width which \a aItem can be batch-tested with, its hole
+     * included.
+     *
+     * @return false if \a aItem is neither a segment nor a via.
+     */
+    static bool batchReference( const ITEM* aItem, SEG& aSeg, int& aRadius );
+
     template <class Visitor>
     int querySingle( std::size_t aIndex, const SHAPE* aShape, int aMinDistance, Visitor& aVisitor ) const;
 
@@ -143,9 +152,64 @@ int INDEX::Query( const ITEM* aItem, int aMinDistance, Visitor& aVisitor ) const
     int total = 0;
 
     const LAYER_RANGE& layers = aItem->Layers();
+    SEG                refSeg;
+    int                refRadius;
+
+    if( !batchReference( aItem, refSeg, refRadius ) )
+    {
+        for( int i = layers.Start(); i <= layers.End(); ++i )
+            total += querySingle( i, aItem->Shape(), aMinDistance, aVisitor );
+
+        return total;
+    }
+
+    // Segments and vias are checked against the segments and vias found in the index as one
+    // batch, so that the visitor only sees the ones within aMinDistance of aItem.
+    std::vector<ITEM*>   candidates;
+    std::vector<int>     batchSlots;
+    std::vector<uint8_t> mayCollide;
+    SEG_BATCH            batch;
+
+    auto collect =
+            [&]( ITEM* aCandidate ) -> bool
+            {
+                SEG seg;
+                int radius;
+
+                candidates.push_back( aCandidate );
+
+                if( aCandidate->OfKind( ITEM::SEGMENT_T | ITEM::VIA_T )
+                        && SEG_BATCH::AsSegment( aCandidate->Shape(), seg, radius ) )
+                {
+                    batchSlots.push_back( (int) batch.Size() );
+                    batch.Add( seg, radius );
+                }
+                else
+                {
+                    batchSlots.push_back( -1 );
+                }
+
+                return true;
+            };
 
     for( int i = layers.Start(); i <= layers.End(); ++i )
-        total += querySingle( i, aItem->Shape(), aMinDistance, aVisitor );
+    {
+        candidates.clear();
+        batchSlots.clear();
+        batch.Clear();
+
+        total += querySingle( i, aItem->Shape(), aMinDistance, collect );
+        batch.MayCollide( refSeg, refRadius, aMinDistance, mayCollide );
+
+        for( size_t ii = 0; ii < candidates.size(); ++ii )
+        {
+            if( batchSlots[ii] >= 0 && !mayCollide[ batchSlots[ii] ] )
+                continue;
+
+            if( !aVisitor( candidates[ii] ) )
+                break;
+        }
+    }
 
     return total;
 }
@@ -266,14 +266,18 @@ int NODE::QueryColliding( const ITEM* aItem, NODE::OBSTACLES& aObstacles,
 
     visitor.SetWorld( this, nullptr );
 
+    // The index leaves out the items further away than the query distance, so it must cover
+    // an overridden clearance too
+    int queryDistance = std::max( m_maxClearance, aOpts.m_overrideClearance );
+
     // first, look for colliding items in the local index
-    m_index->Query( aItem, m_maxClearance, visitor );
+    m_index->Query( aItem, queryDistance, visitor );
 
     // if we haven't found enough items, look in the root branch as well.
     if( !isRoot() && ( ctx.obstacles.size() < aOpts.m_limitCount || aOpts.m_limitCount < 0 ) )
     {
         visitor.SetWorld( m_root, this );
-        m_root->m_index->Query( aItem, m_maxClearance, visitor );
+        m_root->m_index->Query( aItem, queryDistance, visitor );
     }
 
     return aObstacles.size();
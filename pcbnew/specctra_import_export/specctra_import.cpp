@@ -346,6 +346,7 @@ void SPECCTRA_DB::FromSESSION( BOARD* aBoard )
     {
         PCB_TRACK* track = aBoard->Tracks().back();
         aBoard->Tracks().pop_back();
+        aBoard->UncacheItemById( track );
 
         if( track->IsLocked() )
         {
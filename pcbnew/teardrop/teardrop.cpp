@@ -23,6 +23,8 @@
  */
 
 
+#include <unordered_set>
+
 #include <confirm.h>
 
 #include <board_design_settings.h>
@@ -32,6 +34,7 @@
 #include <board_commit.h>
 
 #include <connectivity/connectivity_data.h>
+#include <core/thread_pool.h>
 #include <teardrop/teardrop.h>
 #include <drc/drc_rtree.h>
 #include <geometry/shape_line_chain.h>
@@ -100,51 +103,30 @@ void TEARDROP_MANAGER::RemoveTeardrops( BOARD_COMMIT& aCommit,
                                         const std::vector<BOARD_ITEM*>* dirtyPadsAndVias,
                                         const std::set<PCB_TRACK*>* dirtyTracks )
 {
+    if( !dirtyPadsAndVias || dirtyPadsAndVias->empty() )
+        return;
+
     std::shared_ptr<CONNECTIVITY_DATA> connectivity = m_board->GetConnectivity();
-    std::vector<ZONE*>                 stale_teardrops;
+    std::vector<BOARD_ITEM*>           stale_teardrops;
+    std::unordered_set<const ZONE*>    found;
 
-    for( ZONE* zone : m_board->Zones() )
+    // A teardrop is connected to the pad or via it is anchored on, so the stale ones are found
+    // from the dirty pads and vias without looking at the other zones of the board
+    for( BOARD_ITEM* item : *dirtyPadsAndVias )
     {
-        if( zone->IsTeardropArea() )
-        {
-            bool stale = false;
-
-            std::vector<PAD*>     connectedPads;
-            std::vector<PCB_VIA*> connectedVias;
-
-            connectivity->GetConnectedPadsAndVias( zone, &connectedPads, &connectedVias );
-
-            for( PAD* pad : connectedPads )
-            {
-                if( alg::contains( *dirtyPadsAndVias, pad ) )
-                {
-                    stale = true;
-                    break;
-                }
-            }
-
-            if( !stale )
-            {
-                for( PCB_VIA* via : connectedVias )
-                {
-                    if( alg::contains( *dirtyPadsAndVias, via ) )
-                    {
-                        stale = true;
-                        break;
-                    }
-                }
-            }
+        auto connectedItem = static_cast<BOARD_CONNECTED_ITEM*>( item );
 
-            if( stale )
+        for( ZONE* zone : connectivity->GetConnectedZones( connectedItem ) )
+        {
+            if( zone->IsTeardropArea() && found.insert( zone ).second )
                 stale_teardrops.push_back( zone );
         }
     }
 
-    for( ZONE* td : stale_teardrops )
-    {
-        m_board->Remove( td, REMOVE_MODE::BULK );
+    m_board->RemoveItems( stale_teardrops, REMOVE_MODE::BULK );
+
+    for( BOARD_ITEM* td : stale_teardrops )
         aCommit.Removed( td );
-    }
 }
 
 
@@ -164,7 +146,7 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
     // Old teardrops must be removed, to ensure a clean teardrop rebuild
     if( aForceFullUpdate )
     {
-        std::vector<ZONE*> teardrops;
+        std::vector<BOARD_ITEM*> teardrops;
 
         for( ZONE* zone : m_board->Zones() )
         {
@@ -172,30 +154,68 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
                 teardrops.push_back( zone );
         }
 
-        for( ZONE* td : teardrops )
-        {
-            m_board->Remove( td, REMOVE_MODE::BULK );
+        m_board->RemoveItems( teardrops, REMOVE_MODE::BULK );
+
+        for( BOARD_ITEM* td : teardrops )
             aCommit.Removed( td );
-        }
     }
 
     std::shared_ptr<CONNECTIVITY_DATA> connectivity = m_board->GetConnectivity();
 
+    // On an incremental update only the dirty tracks and the tracks connected to a dirty pad or
+    // via can get a new teardrop.  Collect them from the connectivity of the dirty items, so the
+    // other tracks of the board are skipped without querying their connections.
+    std::unordered_set<const BOARD_ITEM*> dirtyItems;
+    std::unordered_set<const PCB_TRACK*>  candidateTracks;
+
+    if( !aForceFullUpdate )
+    {
+        dirtyItems.insert( dirtyPadsAndVias->begin(), dirtyPadsAndVias->end() );
+        candidateTracks.insert( dirtyTracks->begin(), dirtyTracks->end() );
+
+        for( BOARD_ITEM* item : *dirtyPadsAndVias )
+        {
+            // Items deleted by the commit are no longer in the connectivity
+            if( !m_board->IsItemCachedById( item ) )
+                continue;
+
+            auto connectedItem = static_cast<BOARD_CONNECTED_ITEM*>( item );
+
+            for( PCB_TRACK* track : connectivity->GetConnectedTracks( connectedItem ) )
+                candidateTracks.insert( track );
+        }
+    }
+
+    // A teardrop to build, between a track and the pad or via it is connected to
+    struct PADVIA_TEARDROP
+    {
+        PCB_TRACK*            m_Track;
+        BOARD_ITEM*           m_PadOrVia;
+        TEARDROP_PARAMETERS   m_Params;
+        std::vector<VECTOR2I> m_Points;
+        bool                  m_Valid = false;
+    };
+
+    std::vector<PADVIA_TEARDROP> teardrops;
+
     for( PCB_TRACK* track : m_board->Tracks() )
     {
         if( ! ( track->Type() == PCB_TRACE_T || track->Type() == PCB_ARC_T ) )
             continue;
 
+        if( !aForceFullUpdate && !candidateTracks.count( track ) )
+            continue;
+
         std::vector<PAD*>     connectedPads;
         std::vector<PCB_VIA*> connectedVias;
 
         connectivity->GetConnectedPadsAndVias( track, &connectedPads, &connectedVias );
 
-        bool forceUpdate = aForceFullUpdate || alg::contains( *dirtyTracks, track );
+        bool forceUpdate = aForceFullUpdate || dirtyTracks->count( track );
 
         for( PAD* pad : connectedPads )
         {
-            if( !forceUpdate && !alg::contains( *dirtyPadsAndVias, pad ) )
+            if( !forceUpdate && !dirtyItems.count( pad ) )
                 continue;
 
             if( pad->GetShape() == PAD_SHAPE::CUSTOM )
@@ -226,21 +246,12 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
             if( !tdParams.m_TdOnPadsInZones && areItemsInSameZone( pad, track ) )
                 continue;
 
-            std::vector<VECTOR2I> points;
-
-            if( computeTeardropPolygon( tdParams, points, track, pad, pad->GetPosition() ) )
-            {
-                ZONE* new_teardrop = createTeardrop( TD_TYPE_PADVIA, points, track );
-                m_board->Add( new_teardrop, ADD_MODE::BULK_INSERT );
-                m_createdTdList.push_back( new_teardrop );
-
-                aCommit.Added( new_teardrop );
-            }
+            teardrops.push_back( { track, pad, tdParams } );
         }
 
         for( PCB_VIA* via : connectedVias )
         {
-            if( !forceUpdate && !alg::contains( *dirtyPadsAndVias, via ) )
+            if( !forceUpdate && !dirtyItems.count( via ) )
                 continue;
 
             TEARDROP_PARAMETERS tdParams = via->GetTeardropParams();
@@ -262,17 +273,31 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
                 // The track is entirely inside the via; cannot create a teardrop
                 continue;
 
-            std::vector<VECTOR2I> points;
+            teardrops.push_back( { track, via, tdParams } );
+        }
+    }
 
-            if( computeTeardropPolygon( tdParams, points, track, via, via->GetPosition() ) )
+    // The teardrop shapes only read the board, so they are computed in parallel.  The zones are
+    // then created in the order of the tracks, to keep the result independent of the threading.
+    RunOnThreadPool( teardrops.size(),
+            [&]( size_t aIdx )
             {
-                ZONE* new_teardrop = createTeardrop( TD_TYPE_PADVIA, points, track );
-                m_board->Add( new_teardrop, ADD_MODE::BULK_INSERT );
-                m_createdTdList.push_back( new_teardrop );
+                PADVIA_TEARDROP& td = teardrops[aIdx];
 
-                aCommit.Added( new_teardrop );
-            }
-        }
+                td.m_Valid = computeTeardropPolygon( td.m_Params, td.m_Points, td.m_Track,
+                                                     td.m_PadOrVia, td.m_PadOrVia->GetPosition() );
+            } );
+
+    for( PADVIA_TEARDROP& td : teardrops )
+    {
+        if( !td.m_Valid )
+            continue;
+
+        ZONE* new_teardrop = createTeardrop( TD_TYPE_PADVIA, td.m_Points, td.m_Track );
+        m_board->Add( new_teardrop, ADD_MODE::BULK_INSERT );
+        m_createdTdList.push_back( new_teardrop );
+
+        aCommit.Added( new_teardrop );
     }
 
     if( ( aForceFullUpdate || !dirtyTracks->empty() )
@@ -288,7 +313,7 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
 
 void TEARDROP_MANAGER::DeleteTrackToTrackTeardrops( BOARD_COMMIT& aCommit )
 {
-    std::vector<ZONE*> stale_teardrops;
+    std::vector<BOARD_ITEM*> stale_teardrops;
 
     for( ZONE* zone : m_board->Zones() )
     {
@@ -296,11 +321,10 @@ void TEARDROP_MANAGER::DeleteTrackToTrackTeardrops( BOARD_COMMIT& aCommit )
             stale_teardrops.push_back( zone );
     }
 
-    for( ZONE* td : stale_teardrops )
-    {
-        m_board->Remove( td, REMOVE_MODE::BULK );
+    m_board->RemoveItems( stale_teardrops, REMOVE_MODE::BULK );
+
+    for( BOARD_ITEM* td : stale_teardrops )
         aCommit.Removed( td );
-    }
 }
 
 
@@ -381,7 +405,7 @@ void TEARDROP_MANAGER::AddTeardropsOnTracks( BOARD_COMMIT& aCommit,
         {
             PCB_TRACK* track = (*sublist)[ii];
             int        track_len = (int) track->GetLength();
-            bool       track_needs_update = aForceFullUpdate || alg::contains( *aTracks, track );
+            bool       track_needs_update = aForceFullUpdate || aTracks->count( track );
             min_width = track->GetWidth();
 
             // to avoid creating a teardrop between 2 tracks having similar widths give a threshold
@@ -418,7 +442,7 @@ void TEARDROP_MANAGER::AddTeardropsOnTracks( BOARD_COMMIT& aCommit,
                 if( !match_points )
                     continue;
 
-                if( !track_needs_update && alg::contains( *aTracks, candidate ) )
+                if( !track_needs_update && aTracks->count( candidate ) )
                     continue;
 
                 // Pads/vias have priority for teardrops; ensure there isn't one at our position
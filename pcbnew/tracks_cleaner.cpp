@@ -23,11 +23,15 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
+#include <deque>
+#include <unordered_set>
+
 #include <reporter.h>
 #include <board_commit.h>
 #include <cleanup_item.h>
 #include <connectivity/connectivity_algo.h>
 #include <connectivity/connectivity_data.h>
+#include <core/thread_pool.h>
 #include <tool/tool_manager.h>
 #include <tools/pcb_actions.h>
 #include <tools/global_edit_tool.h>
@@ -248,61 +252,65 @@ bool TRACKS_CLEANER::testTrackEndpointIsNode( PCB_TRACK* aTrack, bool aTstStart
 
 bool TRACKS_CLEANER::deleteDanglingTracks( bool aTrack, bool aVia )
 {
-    bool item_erased = false;
-    bool modified = false;
-
     if( !aTrack && !aVia )
         return false;
 
-    do // Iterate when at least one track is deleted
-    {
-        item_erased = false;
-        // Ensure the connectivity is up to date, especially after removing a dangling segment
-        m_brd->BuildConnectivity();
+    // Ensure the connectivity is up to date
+    m_brd->BuildConnectivity();
 
-        // Keep a duplicate deque to all deleting in the primary
-        std::deque<PCB_TRACK*> temp_tracks( m_brd->Tracks() );
+    std::shared_ptr<CONNECTIVITY_DATA> connectivity = m_brd->GetConnectivity();
+    std::set<BOARD_ITEM*>              toRemove;
 
-        for( PCB_TRACK* track : temp_tracks )
-        {
-            if( track->IsLocked() || ( track->GetFlags() & IS_DELETED ) > 0 )
-                continue;
+    // Dangling items are only flagged until the end, which the dangling test honours.  So once
+    // every track has been tested, only the neighbours of a newly dangling item can become
+    // dangling in turn, and there is no need to rebuild the connectivity and test the whole
+    // board again.
+    std::deque<PCB_TRACK*> toTest( m_brd->Tracks().begin(), m_brd->Tracks().end() );
 
-            if( !aVia && track->Type() == PCB_VIA_T )
-                continue;
+    while( !toTest.empty() )
+    {
+        PCB_TRACK* track = toTest.front();
+        toTest.pop_front();
 
-            if( !aTrack && ( track->Type() == PCB_TRACE_T || track->Type() == PCB_ARC_T ) )
-                continue;
+        if( track->IsLocked() || ( track->GetFlags() & IS_DELETED ) > 0 )
+            continue;
 
-            // Test if a track (or a via) endpoint is not connected to another track or zone.
-            if( m_brd->GetConnectivity()->TestTrackEndpointDangling( track, false ) )
-            {
-                std::shared_ptr<CLEANUP_ITEM> item;
+        if( !aVia && track->Type() == PCB_VIA_T )
+            continue;
 
-                if( track->Type() == PCB_VIA_T )
-                    item = std::make_shared<CLEANUP_ITEM>( CLEANUP_DANGLING_VIA );
-                else
-                    item = std::make_shared<CLEANUP_ITEM>( CLEANUP_DANGLING_TRACK );
+        if( !aTrack && ( track->Type() == PCB_TRACE_T || track->Type() == PCB_ARC_T ) )
+            continue;
 
-                item->SetItems( track );
-                m_itemsList->push_back( item );
-                track->SetFlags( IS_DELETED );
+        // Test if a track (or a via) endpoint is not connected to another track or zone.
+        if( connectivity->TestTrackEndpointDangling( track, false ) )
+        {
+            std::shared_ptr<CLEANUP_ITEM> item;
 
-                // keep iterating, because a track connected to the deleted track
-                // now perhaps is not connected and should be deleted
-                item_erased = true;
+            if( track->Type() == PCB_VIA_T )
+                item = std::make_shared<CLEANUP_ITEM>( CLEANUP_DANGLING_VIA );
+            else
+                item = std::make_shared<CLEANUP_ITEM>( CLEANUP_DANGLING_TRACK );
 
-                if( !m_dryRun )
-                {
-                    m_brd->Remove( track );
-                    m_commit.Removed( track );
-                    modified = true;
-                }
+            item->SetItems( track );
+            m_itemsList->push_back( item );
+            track->SetFlags( IS_DELETED );
+            toRemove.insert( track );
+
+            // A track connected to the deleted track now perhaps is not connected and should
+            // be deleted
+            for( PCB_TRACK* neighbour : connectivity->GetConnectedTracks( track ) )
+            {
+                if( !neighbour->HasFlag( IS_DELETED ) )
+                    toTest.push_back( neighbour );
             }
         }
-    } while( item_erased ); // A segment was erased: test for some new dangling segments
+    }
+
+    if( m_dryRun || toRemove.empty() )
+        return false;
 
-    return modified;
+    removeItems( toRemove );
+    return true;
 }
 
 
@@ -313,6 +321,10 @@ void TRACKS_CLEANER::deleteTracksInPads()
     // Delete tracks that start and end on the same pad
     std::shared_ptr<CONNECTIVITY_DATA> connectivity = m_brd->GetConnectivity();
 
+    // The tracks with both ends in a connected pad are collected first; checking whether they
+    // are fully covered by the pad is the expensive part, and is done in parallel.
+    std::vector<std::pair<PCB_TRACK*, PAD*>> candidates;
+
     for( PCB_TRACK* track : m_brd->Tracks() )
     {
         if( track->IsLocked() )
@@ -321,29 +333,45 @@ void TRACKS_CLEANER::deleteTracksInPads()
         if( track->Type() == PCB_VIA_T )
             continue;
 
-        // Mark track if connected to pads
         for( PAD* pad : connectivity->GetConnectedPads( track ) )
         {
             if( pad->HitTest( track->GetStart() ) && pad->HitTest( track->GetEnd() ) )
+                candidates.emplace_back( track, pad );
+        }
+    }
+
+    std::vector<uint8_t> inPad( candidates.size(), 0 );
+
+    RunOnThreadPool( candidates.size(),
+            [&]( size_t aIdx )
             {
+                PCB_TRACK*     track = candidates[aIdx].first;
+                PAD*           pad = candidates[aIdx].second;
                 SHAPE_POLY_SET poly;
+
                 track->TransformShapeToPolygon( poly, track->GetLayer(), 0, ARC_HIGH_DEF,
                                                 ERROR_INSIDE );
 
                 poly.BooleanSubtract( *pad->GetEffectivePolygon( ERROR_INSIDE ),
                                       SHAPE_POLY_SET::PM_FAST );
 
-                if( poly.IsEmpty() )
-                {
-                    auto item = std::make_shared<CLEANUP_ITEM>( CLEANUP_TRACK_IN_PAD );
-                    item->SetItems( track );
-                    m_itemsList->push_back( item );
+                inPad[aIdx] = poly.IsEmpty();
+            } );
 
-                    toRemove.insert( track );
-                    track->SetFlags( IS_DELETED );
-                }
-            }
-        }
+    // Mark track if fully inside a connected pad
+    for( size_t ii = 0; ii < candidates.size(); ++ii )
+    {
+        if( !inPad[ii] )
+            continue;
+
+        PCB_TRACK* track = candidates[ii].first;
+
+        auto item = std::make_shared<CLEANUP_ITEM>( CLEANUP_TRACK_IN_PAD );
+        item->SetItems( track );
+        m_itemsList->push_back( item );
+
+        toRemove.insert( track );
+        track->SetFlags( IS_DELETED );
     }
 
     if( !m_dryRun )
@@ -483,6 +511,26 @@ void TRACKS_CLEANER::cleanup( bool aDeleteDuplicateVias, bool aDeleteNullSegment
     auto mergeSegments =
             [&]( std::shared_ptr<CN_CONNECTIVITY_ALGO> connectivity ) -> bool
             {
+                // The connectivity data is not updated while merging.  Segments merged during
+                // this pass, and the ones connected to them, are left for the next pass; all the
+                // other segments can be merged in the same pass.
+                std::unordered_set<BOARD_CONNECTED_ITEM*> merged;
+                std::set<BOARD_ITEM*>                     toRemove;
+
+                auto isStale =
+                        [&]( PCB_TRACK* aSegment ) -> bool
+                        {
+                            if( merged.count( aSegment ) )
+                                return true;
+
+                            for( BOARD_CONNECTED_ITEM* item : getConnectedItems( aSegment ) )
+                            {
+                                if( merged.count( item ) )
+                                    return true;
+                            }
+
+                            return false;
+                        };
 
                 for( PCB_TRACK* segment : m_brd->Tracks() )
                 {
@@ -493,6 +541,11 @@ void TRACKS_CLEANER::cleanup( bool aDeleteDuplicateVias, bool aDeleteNullSegment
                     if( segment->HasFlag( IS_DELETED ) )  // already taken into account
                         continue;
 
+                    if( isStale( segment ) )
+                        continue;
+
+                    bool segmentMerged = false;
+
                     // for each end of the segment:
                     for( CN_ITEM* citem : connectivity->ItemEntry( segment ).GetItems() )
                     {
@@ -530,25 +583,45 @@ void TRACKS_CLEANER::cleanup( bool aDeleteDuplicateVias, bool aDeleteNullSegment
 
                         for( PCB_TRACK* candidate : sameWidthCandidates )
                         {
+                            if( isStale( candidate ) )
+                                continue;
+
                             if( segment->ApproxCollinear( *candidate )
                                     && mergeCollinearSegments( segment, candidate ) )
                             {
-                                return true;
+                                merged.insert( segment );
+                                merged.insert( candidate );
+                                toRemove.insert( candidate );
+                                segmentMerged = true;
+                                break;
                             }
                         }
+
+                        if( segmentMerged )
+                            break;
                     }
                 }
 
-                return false;
+                if( !m_dryRun )
+                    removeItems( toRemove );
+
+                return !merged.empty();
             };
 
     if( aMergeSegments )
     {
+        bool firstPass = true;
+
         do
         {
-            while( !m_brd->BuildConnectivity() )
-                wxSafeYield();
+            // A dry run does not change the board, so the connectivity stays valid
+            if( firstPass || !m_dryRun )
+            {
+                while( !m_brd->BuildConnectivity() )
+                    wxSafeYield();
+            }
 
+            firstPass = false;
             m_connectedItemsCache.clear();
         } while( mergeSegments( m_brd->GetConnectivity()->GetConnectivityAlgo() ) );
     }
@@ -686,16 +759,12 @@ bool TRACKS_CLEANER::mergeCollinearSegments( PCB_TRACK* aSeg1, PCB_TRACK* aSeg2
 
     aSeg2->SetFlags( IS_DELETED );
 
+    // Merge successful, seg2 has to go away; the caller removes it and rebuilds the
+    // connectivity once all the merges of a pass are done
     if( !m_dryRun )
     {
         m_commit.Modify( aSeg1 );
         *aSeg1 = dummy_seg;
-
-        m_brd->GetConnectivity()->Update( aSeg1 );
-
-        // Merge successful, seg2 has to go away
-        m_brd->Remove( aSeg2 );
-        m_commit.Removed( aSeg2 );
     }
 
     if( dummy_seg.GetParentGroup() )
@@ -707,9 +776,11 @@ bool TRACKS_CLEANER::mergeCollinearSegments( PCB_TRACK* aSeg1, PCB_TRACK* aSeg2
 
 void TRACKS_CLEANER::removeItems( std::set<BOARD_ITEM*>& aItems )
 {
+    if( aItems.empty() )
+        return;
+
+    m_brd->RemoveItems( std::vector<BOARD_ITEM*>( aItems.begin(), aItems.end() ) );
+
     for( BOARD_ITEM* item : aItems )
-    {
-        m_brd->Remove( item );
         m_commit.Removed( item );
-    }
 }
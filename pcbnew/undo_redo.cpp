@@ -35,6 +35,8 @@ using namespace std::placeholders;
 #include <pcb_target.h>
 #include <footprint.h>
 #include <pad.h>
+#include <pcb_shape.h>
+#include <zone.h>
 #include <origin_viewitem.h>
 #include <connectivity/connectivity_data.h>
 #include <tool/tool_manager.h>
@@ -517,11 +519,11 @@ void PCB_BASE_EDIT_FRAME::ClearUndoORRedoList( UNDO_REDO_LIST whichList, int aIt
     {
         for( int ii = 0; ii < aItemCount; ii++ )
         {
-            if( list.m_CommandsList.size() == 0 )
+            PICKED_ITEMS_LIST* curr_cmd = list.PopOldestCommand();
+
+            if( !curr_cmd )
                 break;
 
-            PICKED_ITEMS_LIST* curr_cmd = list.m_CommandsList[0];
-            list.m_CommandsList.erase( list.m_CommandsList.begin() );
             ClearListAndDeleteItems( curr_cmd );
             delete curr_cmd;    // Delete command
         }
@@ -545,6 +547,86 @@ void PCB_BASE_EDIT_FRAME::ClearListAndDeleteItems( PICKED_ITEMS_LIST* aList )
 }
 
 
+/**
+ * Rough size in bytes of a board item copy held by the undo buffer.  Only the geometry which
+ * can get large is looked at.
+ */
+static size_t undoItemMemory( const EDA_ITEM* aItem )
+{
+    // The item itself and its usual members
+    const size_t itemSize = 512;
+
+    // A polygon vertex and its arc reference
+    const size_t pointSize = sizeof( VECTOR2I ) + 2 * sizeof( size_t );
+
+    switch( aItem->Type() )
+    {
+    case PCB_ZONE_T:
+    {
+        const ZONE* zone = static_cast<const ZONE*>( aItem );
+        size_t      size = itemSize + zone->Outline()->FullPointCount() * pointSize;
+
+        // Fills still shared with the zone on the board cost nothing more
+        for( PCB_LAYER_ID layer : zone->GetLayerSet().Seq() )
+        {
+            if( zone->HasFilledPolysForLayer( layer )
+                    && zone->GetFilledPolysList( layer ).use_count() == 1 )
+            {
+                size += zone->GetFilledPolysList( layer )->FullPointCount() * pointSize;
+            }
+        }
+
+        return size;
+    }
+
+    case PCB_FOOTPRINT_T:
+    {
+        size_t size = itemSize;
+
+        static_cast<const FOOTPRINT*>( aItem )->RunOnChildren(
+                [&]( BOARD_ITEM* aChild )
+                {
+                    size += undoItemMemory( aChild );
+                } );
+
+        return size;
+    }
+
+    case PCB_SHAPE_T:
+        return itemSize
+               + static_cast<const PCB_SHAPE*>( aItem )->GetPolyShape().FullPointCount()
+                         * pointSize;
+
+    default:
+        return itemSize;
+    }
+}
+
+
+size_t PCB_BASE_EDIT_FRAME::GetUndoCommandMemory( const PICKED_ITEMS_LIST* aCommand ) const
+{
+    size_t size = 0;
+
+    for( unsigned ii = 0; ii < aCommand->GetCount(); ii++ )
+    {
+        ITEM_PICKER picker = aCommand->GetItemWrapper( ii );
+
+        // Same ownership rules as PICKED_ITEMS_LIST::ClearListAndDeleteItems()
+        if( picker.GetLink() )
+            size += undoItemMemory( picker.GetLink() );
+
+        if( picker.GetItem()
+                && ( ( picker.GetFlags() & UR_TRANSIENT )
+                     || picker.GetStatus() == UNDO_REDO::DELETED ) )
+        {
+            size += undoItemMemory( picker.GetItem() );
+        }
+    }
+
+    return size;
+}
+
+
 void PCB_BASE_EDIT_FRAME::RollbackFromUndo()
 {
     PICKED_ITEMS_LIST* undo = PopCommandFromUndoList();
@@ -149,12 +149,17 @@ void ZONE::InitDataFromSrcInCopyCtor( const ZONE& aZone )
     delete m_CornerSelection;
     m_CornerSelection         = nullptr;
 
+    // The filled polygons are not copied but shared with aZone: they are often large, and most
+    // copies (undo buffer, commit images) never modify them.  Whichever zone modifies them
+    // first gets its own copy.
+    m_FilledPolysList.clear();
+
     for( PCB_LAYER_ID layer : aZone.GetLayerSet().Seq() )
     {
         std::shared_ptr<SHAPE_POLY_SET> fill = aZone.m_FilledPolysList.at( layer );
 
         if( fill )
-            m_FilledPolysList[layer] = std::make_shared<SHAPE_POLY_SET>( *fill );
+            m_FilledPolysList[layer] = fill;
         else
             m_FilledPolysList[layer] = std::make_shared<SHAPE_POLY_SET>();
 
@@ -174,6 +179,20 @@ void ZONE::InitDataFromSrcInCopyCtor( const ZONE& aZone )
 }
 
 
+void ZONE::unshareFill( std::shared_ptr<SHAPE_POLY_SET>& aFill )
+{
+    if( aFill && aFill.use_count() > 1 )
+        aFill = std::make_shared<SHAPE_POLY_SET>( *aFill );
+}
+
+
+void ZONE::unshareFills()
+{
+    for( std::pair<const PCB_LAYER_ID, std::shared_ptr<SHAPE_POLY_SET>>& pair : m_FilledPolysList )
+        unshareFill( pair.second );
+}
+
+
 EDA_ITEM* ZONE::Clone() const
 {
     return new ZONE( *this );
@@ -211,7 +230,11 @@ bool ZONE::UnFill()
     {
         change |= !pair.second->IsEmpty();
         m_insulatedIslands[pair.first].clear();
-        pair.second->RemoveAllContours();
+
+        if( pair.second.use_count() > 1 )
+            pair.second = std::make_shared<SHAPE_POLY_SET>();
+        else
+            pair.second->RemoveAllContours();
     }
 
     m_isFilled = false;
@@ -661,6 +684,8 @@ void ZONE::Move( const VECTOR2I& offset )
     HatchBorder();
 
     /* move fills */
+    unshareFills();
+
     for( std::pair<const PCB_LAYER_ID, std::shared_ptr<SHAPE_POLY_SET>>& pair : m_FilledPolysList )
         pair.second->Move( offset );
 
@@ -714,6 +739,8 @@ void ZONE::Rotate( const VECTOR2I& aCentre, const EDA_ANGLE& aAngle )
     HatchBorder();
 
     /* rotate filled areas: */
+    unshareFills();
+
     for( std::pair<const PCB_LAYER_ID, std::shared_ptr<SHAPE_POLY_SET>>& pair : m_FilledPolysList )
         pair.second->Rotate( aAngle, aCentre );
 }
@@ -746,6 +773,8 @@ void ZONE::Mirror( const VECTOR2I& aMirrorRef, bool aMirrorLeftRight )
 
     HatchBorder();
 
+    unshareFills();
+
     for( std::pair<const PCB_LAYER_ID, std::shared_ptr<SHAPE_POLY_SET>>& pair : m_FilledPolysList )
         pair.second->Mirror( aMirrorLeftRight, !aMirrorLeftRight, aMirrorRef );
 }
@@ -1069,17 +1098,29 @@ void ZONE::swapData( BOARD_ITEM* aImage )
 
 void ZONE::CacheTriangulation( PCB_LAYER_ID aLayer )
 {
+    auto cacheFill =
+            [&]( std::shared_ptr<SHAPE_POLY_SET>& aFill )
+            {
+                if( aFill->IsTriangulationUpToDate() && aFill->HasEdgeIndex() )
+                    return;
+
+                // Don't write the caches into a fill still used by a copy of this zone
+                unshareFill( aFill );
+                aFill->CacheTriangulation();
+                aFill->BuildEdgeIndex();
+            };
+
     if( aLayer == UNDEFINED_LAYER )
     {
         for( auto& [ layer, poly ] : m_FilledPolysList )
-            poly->CacheTriangulation();
+            cacheFill( poly );
 
         m_Poly->CacheTriangulation( false );
     }
     else
     {
         if( m_FilledPolysList.count( aLayer ) )
-            m_FilledPolysList[ aLayer ]->CacheTriangulation();
+            cacheFill( m_FilledPolysList[ aLayer ] );
     }
 }
 
@@ -1217,6 +1258,8 @@ bool ZONE::BuildSmoothedPoly( SHAPE_POLY_SET& aSmoothedPoly, PCB_LAYER_ID aLayer
     std::vector<ZONE*> diffNetIntersectingZones;
     GetInteractingZones( aLayer, &sameNetCollidingZones, &diffNetIntersectingZones );
 
+    SHAPE_POLY_SET::BOOLEAN_SESSION sameNetUnion( aSmoothedPoly, SHAPE_POLY_SET::PM_FAST );
+
     for( ZONE* sameNetZone : sameNetCollidingZones )
     {
         BOX2I sameNetBoundingBox = sameNetZone->GetBoundingBox();
@@ -1229,6 +1272,8 @@ bool ZONE::BuildSmoothedPoly( SHAPE_POLY_SET& aSmoothedPoly, PCB_LAYER_ID aLayer
         SHAPE_POLY_SET sameNetPoly = sameNetZone->Outline()->CloneDropTriangulation();
         SHAPE_POLY_SET diffNetPoly;
 
+        SHAPE_POLY_SET::BOOLEAN_SESSION diffNetUnion( diffNetPoly, SHAPE_POLY_SET::PM_FAST );
+
         // Of course there's always a wrinkle.  The same-net intersecting zone *might* get knocked
         // out along the border by a higher-priority, different-net zone.  #12797
         for( ZONE* diffNetZone : diffNetIntersectingZones )
@@ -1236,10 +1281,12 @@ bool ZONE::BuildSmoothedPoly( SHAPE_POLY_SET& aSmoothedPoly, PCB_LAYER_ID aLayer
             if( diffNetZone->HigherPriority( sameNetZone )
                     && diffNetZone->GetBoundingBox().Intersects( sameNetBoundingBox ) )
             {
-                diffNetPoly.BooleanAdd( *diffNetZone->Outline(), SHAPE_POLY_SET::PM_FAST );
+                diffNetUnion.Add( *diffNetZone->Outline() );
             }
         }
 
+        diffNetUnion.Finish( diffNetPoly );
+
         // Second wrinkle.  After unioning the higher priority, different net zones together, we
         // need to check to see if they completely enclose our zone.  If they do, then we need to
         // treat the enclosed zone as isolated, not connected to the outer zone.  #13915
@@ -1256,10 +1303,12 @@ bool ZONE::BuildSmoothedPoly( SHAPE_POLY_SET& aSmoothedPoly, PCB_LAYER_ID aLayer
         if( !isolated )
         {
             sameNetPoly.ClearArcs();
-            aSmoothedPoly.BooleanAdd( sameNetPoly, SHAPE_POLY_SET::PM_FAST );
+            sameNetUnion.Add( sameNetPoly );
         }
     }
 
+    sameNetUnion.Finish( aSmoothedPoly );
+
     if( aBoardOutline )
         aSmoothedPoly.BooleanIntersection( *aBoardOutline, SHAPE_POLY_SET::PM_STRICTLY_SIMPLE );
 
@@ -1291,10 +1340,10 @@ double ZONE::CalculateFilledArea()
 
         for( int i = 0; i < poly->OutlineCount(); i++ )
         {
-            m_area += poly->Outline( i ).Area();
+            m_area += poly->COutline( i ).Area();
 
             for( int j = 0; j < poly->HoleCount( i ); j++ )
-                m_area -= poly->Hole( i, j ).Area();
+                m_area -= poly->CHole( i, j ).Area();
         }
     }
 
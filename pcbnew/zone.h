@@ -618,15 +618,22 @@ public:
         return m_FilledPolysList.at( aLayer );
     }
 
+    /**
+     * @return the filled polygons of \a aLayer, for modification.  If they were shared with a
+     *         copy of this zone, this zone gets its own copy first; use GetFilledPolysList()
+     *         to only read them.
+     */
     SHAPE_POLY_SET* GetFill( PCB_LAYER_ID aLayer )
     {
         wxASSERT( m_FilledPolysList.count( aLayer ) );
+        unshareFill( m_FilledPolysList.at( aLayer ) );
         return m_FilledPolysList.at( aLayer ).get();
     }
 
     /**
      * Create a list of triangles that "fill" the solid areas used for instance to draw
-     * these solid areas on OpenGL.
+     * these solid areas on OpenGL.  Also builds the edge indexes of the filled areas, which
+     * speed up hit tests and DRC.
      */
     void CacheTriangulation( PCB_LAYER_ID aLayer = UNDEFINED_LAYER );
 
@@ -635,7 +642,14 @@ public:
      */
     void SetFilledPolysList( PCB_LAYER_ID aLayer, const SHAPE_POLY_SET& aPolysList )
     {
-        m_FilledPolysList[aLayer] = std::make_shared<SHAPE_POLY_SET>( aPolysList );
+        std::shared_ptr<SHAPE_POLY_SET> fill = std::make_shared<SHAPE_POLY_SET>( aPolysList );
+        auto                            it = m_FilledPolysList.find( aLayer );
+
+        // Parts of the fill which did not change keep their triangulation
+        if( it != m_FilledPolysList.end() && it->second && !fill->IsTriangulationUpToDate() )
+            fill->InheritTriangulation( it->second );
+
+        m_FilledPolysList[aLayer] = fill;
     }
 
     /**
@@ -802,6 +816,17 @@ public:
 protected:
     virtual void swapData( BOARD_ITEM* aImage ) override;
 
+    /**
+     * Give this zone its own copy of \a aFill if it is shared with a copy of the zone.  Must be
+     * called before modifying a fill in place, caches included.
+     */
+    static void unshareFill( std::shared_ptr<SHAPE_POLY_SET>& aFill );
+
+    /**
+     * Call unshareFill() on the filled polygons of all layers.
+     */
+    void unshareFills();
+
 protected:
     SHAPE_POLY_SET*       m_Poly;                ///< Outline of the zone.
     int                   m_cornerSmoothingType;
@@ -896,6 +921,8 @@ protected:
      * a polygon equivalent to m_Poly, without holes but with extra outline segment
      * connecting "holes" with external main outline.  In complex cases an outline
      * described by m_Poly can have many filled areas
+     * Copies of a zone (such as the ones kept by the undo buffer) share the filled polygons
+     * until one of them modifies them, see unshareFill().
      */
     std::map<PCB_LAYER_ID, std::shared_ptr<SHAPE_POLY_SET>> m_FilledPolysList;
 
@@ -573,9 +573,9 @@ bool ZONE_FILLER::Fill( std::vector<ZONE*>& aZones, bool aCheck, wxWindow* aPare
             // to allow deleting a polygon from list without breaking the remaining of the list
             std::sort( islands.begin(), islands.end(), std::greater<int>() );
 
-            std::shared_ptr<SHAPE_POLY_SET> poly = zone->GetFilledPolysList( layer );
-            long long int                   minArea = zone->GetMinIslandArea();
-            ISLAND_REMOVAL_MODE             mode = zone->GetIslandRemovalMode();
+            SHAPE_POLY_SET*     poly = zone->GetFill( layer );
+            long long int       minArea = zone->GetMinIslandArea();
+            ISLAND_REMOVAL_MODE mode = zone->GetIslandRemovalMode();
 
             for( int idx : islands )
             {
@@ -1322,6 +1322,9 @@ void ZONE_FILLER::subtractHigherPriorityZones( const ZONE* aZone, PCB_LAYER_ID a
 {
     BOX2I zoneBBox = aZone->GetBoundingBox();
 
+    // Collect all the knockouts in a single boolean pass rather than one per zone
+    SHAPE_POLY_SET::BOOLEAN_SESSION knockouts( aRawFill, SHAPE_POLY_SET::PM_FAST );
+
     auto knockoutZoneOutline =
             [&]( ZONE* aKnockout )
             {
@@ -1337,7 +1340,7 @@ void ZONE_FILLER::subtractHigherPriorityZones( const ZONE* aZone, PCB_LAYER_ID a
                     SHAPE_POLY_SET outline = aKnockout->Outline()->CloneDropTriangulation();
                     outline.ClearArcs();
 
-                    aRawFill.BooleanSubtract( outline, SHAPE_POLY_SET::PM_FAST );
+                    knockouts.Subtract( outline );
                 }
             };
 
@@ -1366,6 +1369,8 @@ void ZONE_FILLER::subtractHigherPriorityZones( const ZONE* aZone, PCB_LAYER_ID a
             }
         }
     }
+
+    knockouts.Finish( aRawFill );
 }
 
 
@@ -1477,9 +1482,10 @@ bool ZONE_FILLER::fillCopperZone( const ZONE* aZone, PCB_LAYER_ID aLayer, PCB_LA
     if( m_progressReporter && m_progressReporter->IsCancelled() )
         return false;
 
-    // Spoke-end-testing is hugely expensive so we generate cached bounding-boxes to speed
-    // things up a bit.
+    // Spoke-end-testing is hugely expensive so we generate cached bounding-boxes and edge
+    // indexes to speed things up a bit.
     testAreas.BuildBBoxCaches();
+    testAreas.BuildEdgeIndex();
     int interval = 0;
 
     SHAPE_POLY_SET debugSpokes;
@@ -1661,8 +1667,9 @@ bool ZONE_FILLER::fillNonCopperZone( const ZONE* aZone, PCB_LAYER_ID aLayer,
         knockoutGraphicClearance( item );
     }
 
-    aFillPolys = aSmoothedOutline;
-    aFillPolys.BooleanSubtract( clearanceHoles, SHAPE_POLY_SET::PM_FAST );
+    SHAPE_POLY_SET::BOOLEAN_SESSION fill( aSmoothedOutline, SHAPE_POLY_SET::PM_FAST );
+
+    fill.Subtract( clearanceHoles );
 
     for( ZONE* keepout : m_board->Zones() )
     {
@@ -1672,10 +1679,12 @@ bool ZONE_FILLER::fillNonCopperZone( const ZONE* aZone, PCB_LAYER_ID aLayer,
         if( keepout->GetDoNotAllowCopperPour() && keepout->IsOnLayer( aLayer ) )
         {
             if( keepout->GetBoundingBox().Intersects( zone_boundingbox ) )
-                aFillPolys.BooleanSubtract( *keepout->Outline(), SHAPE_POLY_SET::PM_FAST );
+                fill.Subtract( *keepout->Outline() );
         }
     }
 
+    fill.Finish( aFillPolys );
+
     // Features which are min_width should survive pruning; features that are *less* than
     // min_width should not.  Therefore we subtract epsilon from the min_width when
     // deflating/inflating.
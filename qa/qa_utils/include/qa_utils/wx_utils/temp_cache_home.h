@@ -0,0 +1,55 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef QA_TEMP_CACHE_HOME__H
+#define QA_TEMP_CACHE_HOME__H
+
+#include <wx/string.h>
+
+namespace KI_TEST
+{
+
+/**
+ * Point KICAD_CACHE_HOME to a new temporary directory for the lifetime of the object, so that
+ * the cache files written by a test stay out of the user cache.
+ *
+ * The directory is deleted and the previous value of the variable restored on destruction.
+ */
+class TEMP_CACHE_HOME
+{
+public:
+    /**
+     * @param aPrefix is the prefix of the name of the temporary directory.
+     */
+    TEMP_CACHE_HOME( const wxString& aPrefix );
+
+    ~TEMP_CACHE_HOME();
+
+    /// @return the full path of the temporary directory.
+    const wxString& GetPath() const { return m_path; }
+
+private:
+    wxString m_path;
+    wxString m_previousValue;
+    bool     m_hadPreviousValue;
+};
+
+} // namespace KI_TEST
+
+#endif // QA_TEMP_CACHE_HOME__H
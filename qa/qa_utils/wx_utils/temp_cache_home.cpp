@@ -0,0 +1,51 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <qa_utils/wx_utils/temp_cache_home.h>
+
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/utils.h>
+
+
+namespace KI_TEST
+{
+
+TEMP_CACHE_HOME::TEMP_CACHE_HOME( const wxString& aPrefix )
+{
+    m_hadPreviousValue = wxGetEnv( wxT( "KICAD_CACHE_HOME" ), &m_previousValue );
+
+    m_path = wxFileName::CreateTempFileName( aPrefix );
+    wxRemoveFile( m_path );
+    wxFileName::Mkdir( m_path );
+    wxSetEnv( wxT( "KICAD_CACHE_HOME" ), m_path );
+}
+
+
+TEMP_CACHE_HOME::~TEMP_CACHE_HOME()
+{
+    if( m_hadPreviousValue )
+        wxSetEnv( wxT( "KICAD_CACHE_HOME" ), m_previousValue );
+    else
+        wxUnsetEnv( wxT( "KICAD_CACHE_HOME" ) );
+
+    wxFileName::Rmdir( m_path, wxPATH_RMDIR_RECURSIVE );
+}
+
+} // namespace KI_TEST
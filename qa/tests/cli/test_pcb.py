@@ -25,6 +25,7 @@ import utils
 from pathlib import Path
 import pytest
 import re
+import shutil
 from typing import List, Tuple
 from conftest import KiTestFixture
 import sys
@@ -139,3 +140,64 @@ def test_pcb_export_gerber( kitest: KiTestFixture,
         # Comparison DPI = 5080 => 1px == 5um. I.e. allowable error of 15 um after eroding
         assert utils.gerbers_are_equivalent( str( generated_gerber_path ), gbr_source_path, 5080,
                                              originInches, windowsizeInches )
+
+
+def clean_output_path( kitest: KiTestFixture, sub: str ) -> Path:
+    output_path = kitest.get_output_path( sub )
+    shutil.rmtree( output_path )
+
+    return kitest.get_output_path( sub )
+
+
+def test_pcb_convert_single( kitest: KiTestFixture ):
+    input_file = kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/video/video.brd" )
+    output_path = clean_output_path( kitest, "cli/pcb_convert_single" )
+
+    command = ["kicad-cli", "pcb", "convert", "-o", str( output_path ), input_file]
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 0
+    assert output_path.joinpath( "video.kicad_pcb" ).exists()
+
+
+def test_pcb_convert_multiple( kitest: KiTestFixture ):
+    input_files = [ kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/video/video.brd" ),
+                    kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/ecc83/ecc83-pp_v2.brd" ),
+                    kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/interf_u/interf_u.brd" ) ]
+    output_path = clean_output_path( kitest, "cli/pcb_convert_multiple" )
+
+    command = ["kicad-cli", "pcb", "convert", "-o", str( output_path )]
+    command.extend( input_files )
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 0
+    assert "Converted 3 of 3 files" in stdout
+
+    for input_file in input_files:
+        assert output_path.joinpath( Path( input_file ).stem + ".kicad_pcb" ).exists()
+
+
+def test_pcb_convert_multiple_failure( kitest: KiTestFixture ):
+    input_files = [ kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/video/video.brd" ),
+                    kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/video/video.net" ) ]
+    output_path = clean_output_path( kitest, "cli/pcb_convert_multiple_failure" )
+
+    command = ["kicad-cli", "pcb", "convert", "-o", str( output_path )]
+    command.extend( input_files )
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    # The other files are still converted
+    assert exitcode == 3
+    assert "Converted 1 of 2 files" in stdout
+    assert output_path.joinpath( "video.kicad_pcb" ).exists()
+
+
+def test_pcb_convert_output_conflict( kitest: KiTestFixture ):
+    input_file = kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/video/video.brd" )
+    output_path = clean_output_path( kitest, "cli/pcb_convert_output_conflict" )
+
+    command = ["kicad-cli", "pcb", "convert", "-o", str( output_path ), input_file, input_file]
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 4
+    assert not output_path.joinpath( "video.kicad_pcb" ).exists()
@@ -23,6 +23,7 @@
 import utils
 import cairosvg
 import re
+import shutil
 from pathlib import Path
 import pytest
 from typing import List
@@ -161,4 +162,88 @@ def test_sch_export_pythonbom( kitest,
 
     # pythonbom is not currently crossplatform (platform specific paths) to enable diffs
 
-    kitest.add_attachment( str( output_filepath ) )
\ No newline at end of file
+    kitest.add_attachment( str( output_filepath ) )
+
+def clean_output_path( kitest, sub: str ) -> Path:
+    output_path = kitest.get_output_path( sub )
+    shutil.rmtree( output_path )
+
+    return kitest.get_output_path( sub )
+
+
+def test_sch_convert_single( kitest ):
+    input_file = kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/pic_programmer/pic_programmer.sch" )
+    output_path = clean_output_path( kitest, "cli/sch_convert_single" )
+
+    command = ["kicad-cli", "sch", "convert", "-o", str( output_path ), input_file]
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 0
+
+    root_path = output_path.joinpath( "pic_programmer.kicad_sch" )
+    assert root_path.exists()
+    assert output_path.joinpath( "pic_sockets.kicad_sch" ).exists()
+
+    # The root sheet must refer to the converted sub sheet
+    root_text = root_path.read_text( encoding = 'utf-8' )
+    assert '"pic_sockets.kicad_sch"' in root_text
+    assert '"pic_sockets.sch"' not in root_text
+
+
+def test_sch_convert_multiple( kitest ):
+    # Both designs have a "pic_sockets" sub sheet, and the first one has a "pic_programmer" sub
+    # sheet named like the second root sheet: each one must go to a folder of its own
+    input_files = [ kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/flat_hierarchy/flat_hierarchy.sch" ),
+                    kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/pic_programmer/pic_programmer.sch" ) ]
+    output_path = clean_output_path( kitest, "cli/sch_convert_multiple" )
+
+    command = ["kicad-cli", "sch", "convert", "-o", str( output_path )]
+    command.extend( input_files )
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 0
+    assert "Converted 2 of 2 files" in stdout
+
+    flat_path = output_path.joinpath( "flat_hierarchy" )
+    assert flat_path.joinpath( "flat_hierarchy.kicad_sch" ).exists()
+    assert flat_path.joinpath( "pic_programmer.kicad_sch" ).exists()
+    assert flat_path.joinpath( "pic_sockets.kicad_sch" ).exists()
+
+    programmer_path = output_path.joinpath( "pic_programmer" )
+    assert programmer_path.joinpath( "pic_programmer.kicad_sch" ).exists()
+    assert programmer_path.joinpath( "pic_sockets.kicad_sch" ).exists()
+
+
+def test_sch_convert_output_conflict( kitest ):
+    input_file = kitest.get_data_file_path( "pcbnew/plugins/legacy_demos/pic_programmer/pic_programmer.sch" )
+    output_path = clean_output_path( kitest, "cli/sch_convert_output_conflict" )
+
+    command = ["kicad-cli", "sch", "convert", "-o", str( output_path ), input_file, input_file]
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 4
+    assert not any( output_path.iterdir() )
+
+
+def test_sch_convert_eagle( kitest ):
+    input_file = kitest.get_data_file_path( "pcbnew/plugins/eagle/Adafruit-AHT20-PCB/Adafruit AHT20 Temperature & Humidity.sch" )
+    input_path = Path( input_file ).parent
+    output_path = clean_output_path( kitest, "cli/sch_convert_eagle" )
+
+    command = ["kicad-cli", "sch", "convert", "-o", str( output_path ), input_file]
+    stdout, stderr, exitcode = utils.run_and_capture( command )
+
+    assert exitcode == 0
+    assert output_path.joinpath( "Adafruit AHT20 Temperature & Humidity.kicad_sch" ).exists()
+
+    # The symbol library generated by the importer goes to the output folder, along with the
+    # table referring to it, and nothing is written next to the input file
+    libraries = list( output_path.glob( "*.kicad_sym" ) )
+    assert len( libraries ) == 1
+
+    lib_table_path = output_path.joinpath( "sym-lib-table" )
+    assert lib_table_path.exists()
+    assert libraries[0].name in lib_table_path.read_text( encoding = 'utf-8' )
+
+    assert not input_path.joinpath( "sym-lib-table" ).exists()
+    assert not any( input_path.glob( "*.kicad_sym" ) )
@@ -0,0 +1,159 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+/**
+ * @file
+ * Test suite for the library tree search index
+ */
+
+#include <qa_utils/wx_utils/unit_test_utils.h>
+
+// Code under test
+#include <lib_tree_model.h>
+
+
+namespace
+{
+
+class TEST_ITEM : public LIB_TREE_ITEM
+{
+public:
+    TEST_ITEM( const wxString& aName, const wxString& aDescription ) :
+            m_name( aName ),
+            m_description( aDescription )
+    {}
+
+    LIB_ID   GetLibId() const override { return LIB_ID( wxT( "lib" ), m_name ); }
+    wxString GetName() const override { return m_name; }
+    wxString GetLibNickname() const override { return wxT( "lib" ); }
+    wxString GetDescription() override { return m_description; }
+
+    std::vector<SEARCH_TERM> GetSearchTerms() override
+    {
+        return { SEARCH_TERM( m_name, 8 ), SEARCH_TERM( m_description, 1 ) };
+    }
+
+private:
+    wxString m_name;
+    wxString m_description;
+};
+
+
+struct SEARCH_INDEX_FIXTURE
+{
+    SEARCH_INDEX_FIXTURE()
+    {
+        m_items.emplace_back( wxT( "R_0603_1608Metric" ), wxT( "Resistor SMD 0603" ) );
+        m_items.emplace_back( wxT( "C_0603_1608Metric" ), wxT( "Capacitor SMD 0603" ) );
+        m_items.emplace_back( wxT( "SOT-23" ), wxT( "SOT, 3 Pin" ) );
+        m_items.emplace_back( wxT( "SOIC-8_3.9x4.9mm_P1.27mm" ), wxT( "SOIC, 8 Pin" ) );
+        m_items.emplace_back( wxT( "PinHeader_1x02_P2.54mm" ), wxT( "Through hole header" ) );
+
+        for( TEST_ITEM& item : m_items )
+            m_lib.AddItem( &item );
+    }
+
+    /**
+     * Score every item of the library for \a aPattern, with and without the index.
+     */
+    void CheckPattern( const wxString& aPattern )
+    {
+        std::vector<int> expected;
+
+        for( std::unique_ptr<LIB_TREE_NODE>& child : m_lib.m_Children )
+        {
+            EDA_COMBINED_MATCHER matcher( aPattern, CTX_LIBITEM );
+            LIB_TREE_NODE_ITEM*  item = static_cast<LIB_TREE_NODE_ITEM*>( child.get() );
+
+            item->ResetScore();
+            item->UpdateScore( &matcher, wxEmptyString, nullptr, true );
+            expected.push_back( item->m_Score );
+        }
+
+        EDA_COMBINED_MATCHER matcher( aPattern, CTX_LIBITEM );
+
+        m_lib.ResetScore();
+        m_lib.UpdateScore( &matcher, wxEmptyString, nullptr );
+
+        for( size_t ii = 0; ii < m_lib.m_Children.size(); ++ii )
+        {
+            BOOST_TEST_CONTEXT( aPattern << " " << m_lib.m_Children[ii]->m_Name )
+            {
+                BOOST_CHECK_EQUAL( m_lib.m_Children[ii]->m_Score, expected[ii] );
+            }
+        }
+    }
+
+    LIB_TREE_NODE_ROOT     m_root;
+    LIB_TREE_NODE_LIBRARY& m_lib = m_root.AddLib( wxT( "lib" ), wxEmptyString );
+    std::list<TEST_ITEM>   m_items;
+};
+
+} // namespace
+
+
+BOOST_FIXTURE_TEST_SUITE( LibTreeSearchIndex, SEARCH_INDEX_FIXTURE )
+
+
+BOOST_AUTO_TEST_CASE( SubstringPatterns )
+{
+    BOOST_CHECK( EDA_COMBINED_MATCHER( wxT( "0603" ), CTX_LIBITEM ).IsSubstringPattern() );
+    BOOST_CHECK( EDA_COMBINED_MATCHER( wxT( "p2.54mm" ), CTX_LIBITEM ).IsSubstringPattern() );
+    BOOST_CHECK( !EDA_COMBINED_MATCHER( wxT( "r_*" ), CTX_LIBITEM ).IsSubstringPattern() );
+    BOOST_CHECK( !EDA_COMBINED_MATCHER( wxT( "/^sot/" ), CTX_LIBITEM ).IsSubstringPattern() );
+}
+
+
+BOOST_AUTO_TEST_CASE( CandidateFind )
+{
+    LIB_TREE_SEARCH_INDEX index;
+    std::vector<bool>     candidates;
+
+    index.Build( m_lib.m_Children );
+    BOOST_CHECK( index.IsValidFor( m_lib.m_Children ) );
+
+    index.FindCandidates( wxT( "0603" ), candidates );
+    BOOST_CHECK( ( candidates == std::vector<bool>{ true, true, false, false, false } ) );
+
+    // Too short to use the index
+    index.FindCandidates( wxT( "so" ), candidates );
+    BOOST_CHECK( candidates.empty() );
+
+    // Unknown trigram
+    index.FindCandidates( wxT( "xyz" ), candidates );
+    BOOST_CHECK( ( candidates == std::vector<bool>( 5, false ) ) );
+}
+
+
+BOOST_AUTO_TEST_CASE( ScoresMatchUnindexed )
+{
+    for( const wxString& pattern : { wxT( "0603" ), wxT( "sot" ), wxT( "pin" ), wxT( "p2.54mm" ),
+                                     wxT( "soic-8" ), wxT( "r_0603_1608metric" ), wxT( "zzz" ),
+                                     wxT( "so*" ), wxT( "s" ) } )
+    {
+        CheckPattern( pattern );
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <core/thread_pool.h>
+
+
+BOOST_AUTO_TEST_SUITE( ThreadPool )
+
+
+BOOST_AUTO_TEST_CASE( RunsEveryIndex )
+{
+    std::vector<std::atomic<int>> calls( 1000 );
+
+    RunOnThreadPool( calls.size(),
+            [&]( size_t aIndex )
+            {
+                calls[aIndex]++;
+            } );
+
+    for( const std::atomic<int>& count : calls )
+        BOOST_CHECK_EQUAL( count.load(), 1 );
+}
+
+
+BOOST_AUTO_TEST_CASE( RethrowsAfterAllWorkersReturn )
+{
+    std::atomic<int> running( 0 );
+    std::atomic<int> calls( 0 );
+
+    // Throw from several indices, some of them likely on the calling thread
+    BOOST_CHECK_THROW( RunOnThreadPool( 200,
+                               [&]( size_t aIndex )
+                               {
+                                   running++;
+                                   calls++;
+
+                                   if( aIndex % 50 == 7 )
+                                   {
+                                       running--;
+                                       throw std::runtime_error( "failed" );
+                                   }
+
+                                   running--;
+                               } ),
+                       std::runtime_error );
+
+    // No worker may still be using this frame once the exception reached us
+    BOOST_CHECK_EQUAL( running.load(), 0 );
+    BOOST_CHECK( calls.load() <= 200 );
+
+    // The pool is still usable afterwards
+    std::atomic<int> after( 0 );
+
+    RunOnThreadPool( 100,
+            [&]( size_t )
+            {
+                after++;
+            } );
+
+    BOOST_CHECK_EQUAL( after.load(), 100 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
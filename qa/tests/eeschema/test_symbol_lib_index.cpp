@@ -0,0 +1,129 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Test suite for SYMBOL_LIB_INDEX.
+ */
+
+#include <qa_utils/wx_utils/temp_cache_home.h>
+#include <qa_utils/wx_utils/unit_test_utils.h>
+
+#include <wx/ffile.h>
+#include <wx/filename.h>
+
+#include <lib_symbol.h>
+
+// Code under test
+#include <symbol_lib_index.h>
+
+
+class SYMBOL_LIB_INDEX_TEST_FIXTURE
+{
+public:
+    SYMBOL_LIB_INDEX_TEST_FIXTURE() :
+            m_cacheHome( wxT( "kicad_symbol_index" ) )
+    {
+        wxFileName libFn( m_cacheHome.GetPath(), wxT( "test.kicad_sym" ) );
+        m_libPath = libFn.GetFullPath();
+        writeLibrary( "(kicad_symbol_lib)\n" );
+
+        m_resistor = std::make_unique<LIB_SYMBOL>( wxS( "R" ) );
+        m_resistor->SetDescription( wxS( "Resistor" ) );
+        m_resistor->SetKeyWords( wxS( "R res resistor" ) );
+
+        m_ground = std::make_unique<LIB_SYMBOL>( wxS( "GND" ) );
+        m_ground->SetDescription( wxS( "Power symbol" ) );
+        m_ground->SetPower();
+    }
+
+    void writeLibrary( const std::string& aContent )
+    {
+        wxFFile file( m_libPath, wxT( "wb" ) );
+        file.Write( aContent.data(), aContent.size() );
+    }
+
+    std::vector<LIB_SYMBOL*> symbols() { return { m_resistor.get(), m_ground.get() }; }
+
+    ///< Keeps the indexes written by the tests out of the user cache
+    KI_TEST::TEMP_CACHE_HOME    m_cacheHome;
+    wxString                    m_libPath;
+    std::unique_ptr<LIB_SYMBOL> m_resistor;
+    std::unique_ptr<LIB_SYMBOL> m_ground;
+};
+
+
+BOOST_FIXTURE_TEST_SUITE( SymbolLibIndex, SYMBOL_LIB_INDEX_TEST_FIXTURE )
+
+
+/**
+ * Check that a written index reads back the chooser metadata of every symbol.
+ */
+BOOST_AUTO_TEST_CASE( RoundTrip )
+{
+    std::vector<std::unique_ptr<SYMBOL_INDEX_ENTRY>> entries;
+
+    BOOST_CHECK( !SYMBOL_LIB_INDEX::Read( m_libPath, wxS( "Lib" ), false, entries ) );
+
+    SYMBOL_LIB_INDEX::Write( m_libPath, symbols() );
+
+    BOOST_REQUIRE( SYMBOL_LIB_INDEX::Read( m_libPath, wxS( "Lib" ), false, entries ) );
+    BOOST_REQUIRE_EQUAL( entries.size(), 2 );
+
+    BOOST_CHECK( entries[0]->GetLibId() == LIB_ID( wxS( "Lib" ), wxS( "R" ) ) );
+    BOOST_CHECK_EQUAL( entries[0]->GetDescription(), wxS( "Resistor" ) );
+    BOOST_CHECK( !entries[0]->IsPower() );
+    BOOST_CHECK_EQUAL( entries[0]->GetUnitCount(), m_resistor->GetUnitCount() );
+    BOOST_CHECK_EQUAL( entries[0]->GetSearchTerms().size(),
+                       m_resistor->GetSearchTerms().size() );
+
+    BOOST_CHECK( entries[1]->GetLibId() == LIB_ID( wxS( "Lib" ), wxS( "GND" ) ) );
+    BOOST_CHECK( entries[1]->IsPower() );
+
+    BOOST_REQUIRE( SYMBOL_LIB_INDEX::Read( m_libPath, wxS( "Lib" ), true, entries ) );
+    BOOST_REQUIRE_EQUAL( entries.size(), 1 );
+    BOOST_CHECK_EQUAL( entries[0]->GetName(), wxS( "GND" ) );
+}
+
+
+/**
+ * Check that an index is ignored once its library changes on disk.
+ */
+BOOST_AUTO_TEST_CASE( Invalidation )
+{
+    std::vector<std::unique_ptr<SYMBOL_INDEX_ENTRY>> entries;
+
+    SYMBOL_LIB_INDEX::Write( m_libPath, symbols() );
+    BOOST_REQUIRE( SYMBOL_LIB_INDEX::Read( m_libPath, wxS( "Lib" ), false, entries ) );
+
+    writeLibrary( "(kicad_symbol_lib (version 20231120))\n" );
+
+    BOOST_CHECK( !SYMBOL_LIB_INDEX::Read( m_libPath, wxS( "Lib" ), false, entries ) );
+    BOOST_CHECK( entries.empty() );
+
+    // Another library must never pick up this index
+    wxFileName otherFn( m_cacheHome.GetPath(), wxT( "other.kicad_sym" ) );
+    wxCopyFile( m_libPath, otherFn.GetFullPath() );
+
+    SYMBOL_LIB_INDEX::Write( m_libPath, symbols() );
+    BOOST_CHECK( !SYMBOL_LIB_INDEX::Read( otherFn.GetFullPath(), wxS( "Lib" ), false, entries ) );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,9 @@
 #include <qa_utils/wx_utils/unit_test_utils.h>
 
 #include <geometry/seg.h>
+#include <geometry/seg_batch.h>
+#include <geometry/shape_circle.h>
+#include <geometry/shape_segment.h>
 
 /**
  * Predicate to check expected collision between two segments
@@ -695,4 +698,66 @@ BOOST_AUTO_TEST_CASE( SegCreatePerpendicular )
     }
 }
 
+/**
+ * The batched test may only reject the segments and circles which the exact test doesn't find
+ * colliding.
+ */
+BOOST_AUTO_TEST_CASE( SegBatchConservative )
+{
+    std::vector<std::unique_ptr<SHAPE>> shapes;
+    SEG_BATCH                           batch;
+
+    for( int x = -3000; x <= 3000; x += 250 )
+    {
+        for( int y = -2000; y <= 2000; y += 250 )
+        {
+            shapes.push_back( std::make_unique<SHAPE_CIRCLE>( VECTOR2I( x, y ), 100 + x % 7 ) );
+            shapes.push_back( std::make_unique<SHAPE_SEGMENT>( VECTOR2I( x, y ),
+                                                               VECTOR2I( x + y / 3, y - 700 ),
+                                                               50 + ( y & 0xff ) ) );
+        }
+    }
+
+    for( const std::unique_ptr<SHAPE>& shape : shapes )
+    {
+        SEG seg;
+        int radius;
+
+        BOOST_REQUIRE( SEG_BATCH::AsSegment( shape.get(), seg, radius ) );
+        batch.Add( seg, radius );
+    }
+
+    const std::vector<SHAPE_SEGMENT> refs = { SHAPE_SEGMENT( VECTOR2I( -1000, -300 ),
+                                                             VECTOR2I( 1200, 450 ), 200 ),
+                                              SHAPE_SEGMENT( VECTOR2I( 10, 10 ),
+                                                             VECTOR2I( 10, 10 ), 301 ),
+                                              SHAPE_SEGMENT( VECTOR2I( 0, -5000 ),
+                                                             VECTOR2I( 1, 5000 ), 0 ) };
+
+    for( const SHAPE_SEGMENT& ref : refs )
+    {
+        for( int clearance : { 0, 17, 400 } )
+        {
+            std::vector<uint8_t> mayCollide;
+            size_t               collisions = 0;
+            size_t               candidates = batch.MayCollide( ref.GetSeg(), ref.GetWidth() / 2,
+                                                                clearance, mayCollide );
+
+            BOOST_REQUIRE_EQUAL( mayCollide.size(), shapes.size() );
+
+            for( size_t ii = 0; ii < shapes.size(); ++ii )
+            {
+                if( ref.Collide( shapes[ii].get(), clearance ) )
+                {
+                    BOOST_CHECK( mayCollide[ii] );
+                    collisions++;
+                }
+            }
+
+            BOOST_CHECK_GE( candidates, collisions );
+            BOOST_CHECK_LT( candidates, shapes.size() );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -973,4 +973,73 @@ BOOST_AUTO_TEST_CASE( ReplaceChain )
 }
 
 
+/**
+ * A comb of \a aTeeth segments going up and down between y = 100 and y = 200.
+ */
+static SHAPE_LINE_CHAIN combChain( int aTeeth )
+{
+    SHAPE_LINE_CHAIN chain;
+
+    for( int i = 0; i <= aTeeth; i++ )
+        chain.Append( VECTOR2I( i * 100, ( i % 2 ) ? 200 : 100 ) );
+
+    return chain;
+}
+
+
+// Test SHAPE_LINE_CHAIN::SelfIntersecting() on chains long enough to be swept
+BOOST_AUTO_TEST_CASE( SelfIntersectingLongChain )
+{
+    SHAPE_LINE_CHAIN comb = combChain( 199 );
+
+    comb.Append( VECTOR2I( 19900, 0 ) );
+    comb.Append( VECTOR2I( 0, 0 ) );
+    comb.SetClosed( true );
+
+    BOOST_CHECK( !comb.SelfIntersecting() );
+
+    // Pull one tooth through the bottom edge
+    comb.SetPoint( 100, VECTOR2I( 10000, -50 ) );
+
+    std::optional<SHAPE_LINE_CHAIN::INTERSECTION> is = comb.SelfIntersecting();
+
+    BOOST_REQUIRE( is );
+    BOOST_CHECK_EQUAL( is->index_our, 99 );
+    BOOST_CHECK_EQUAL( is->index_their, 200 );
+    BOOST_CHECK_EQUAL( is->p, VECTOR2I( 9980, 0 ) );
+}
+
+
+// Test SHAPE_LINE_CHAIN::Intersect( SHAPE_LINE_CHAIN ) on chains long enough to be swept
+BOOST_AUTO_TEST_CASE( IntersectLongChains )
+{
+    SHAPE_LINE_CHAIN comb = combChain( 199 );
+    SHAPE_LINE_CHAIN line;
+
+    for( int k = 0; k <= 100; k++ )
+        line.Append( VECTOR2I( k * 200 - 25, 150 ) );
+
+    SHAPE_LINE_CHAIN::INTERSECTIONS ips;
+
+    BOOST_REQUIRE_EQUAL( comb.Intersect( line, ips ), 199 );
+
+    for( int i = 0; i < 199; i++ )
+    {
+        BOOST_TEST_CONTEXT( "Comb segment " << i )
+        {
+            // Reported in segment order, like the all-pairs search
+            BOOST_CHECK_EQUAL( ips[i].index_our, i );
+            BOOST_CHECK_EQUAL( ips[i].index_their, ( i * 100 + 50 + 25 ) / 200 );
+            BOOST_CHECK_EQUAL( ips[i].p, VECTOR2I( i * 100 + 50, 150 ) );
+        }
+    }
+
+    // Shifted out of reach
+    line.Move( VECTOR2I( 0, 1000 ) );
+    ips.clear();
+
+    BOOST_CHECK_EQUAL( comb.Intersect( line, ips ), 0 );
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -64,4 +64,189 @@ BOOST_AUTO_TEST_CASE( RemoveNullSegments )
 
 }
 
+
+/**
+ * Sum of the areas of the triangles of a triangulated polygon set
+ */
+static double triangulatedArea( const SHAPE_POLY_SET& aSet )
+{
+    double area = 0.0;
+
+    for( unsigned ii = 0; ii < aSet.TriangulatedPolyCount(); ii++ )
+    {
+        const SHAPE_POLY_SET::TRIANGULATED_POLYGON* tpoly = aSet.TriangulatedPolygon( ii );
+
+        for( size_t jj = 0; jj < tpoly->GetTriangleCount(); jj++ )
+        {
+            VECTOR2I a, b, c;
+            tpoly->GetTriangle( jj, a, b, c );
+
+            area += std::abs( VECTOR2D( b - a ).Cross( VECTOR2D( c - a ) ) ) / 2.0;
+        }
+    }
+
+    return area;
+}
+
+
+BOOST_AUTO_TEST_CASE( PartitionedTriangulation )
+{
+    // 5cm x 3cm, so that it is split over several 1cm partitions
+    SHAPE_LINE_CHAIN outline;
+    SHAPE_LINE_CHAIN hole;
+
+    for( int ii = 0; ii < 1000; ii++ )
+    {
+        EDA_ANGLE angle = FULL_CIRCLE * ii / 1000;
+        outline.Append( KiROUND( 25000000 * angle.Cos() ), KiROUND( 15000000 * angle.Sin() ) );
+    }
+
+    hole.Append( -5000000, -5000000 );
+    hole.Append( -5000000, 5000000 );
+    hole.Append( 5000000, 5000000 );
+    hole.Append( 5000000, -5000000 );
+
+    outline.SetClosed( true );
+    hole.SetClosed( true );
+
+    SHAPE_POLY_SET set;
+
+    set.AddOutline( outline );
+    set.AddHole( hole );
+
+    set.CacheTriangulation();
+
+    BOOST_CHECK( set.IsTriangulationUpToDate() );
+    BOOST_CHECK_GT( set.TriangulatedPolyCount(), 1 );
+    BOOST_CHECK_CLOSE( triangulatedArea( set ), outline.Area() - hole.Area(), 0.01 );
+
+    // An edited copy reusing the previous triangulation must match a fresh one
+    SHAPE_POLY_SET edited = set.CloneDropTriangulation();
+
+    edited.NewOutline();
+    edited.Append( 40000000, 0 );
+    edited.Append( 40000000, 1000000 );
+    edited.Append( 41000000, 1000000 );
+    edited.Append( 41000000, 0 );
+
+    SHAPE_POLY_SET fresh = edited.CloneDropTriangulation();
+    auto           previous = std::make_shared<const SHAPE_POLY_SET>( set );
+
+    // The triangles are only reused once checked by CacheTriangulation()
+    edited.InheritTriangulation( previous );
+    BOOST_CHECK( !edited.IsTriangulationUpToDate() );
+    BOOST_CHECK_EQUAL( edited.TriangulatedPolyCount(), 0 );
+
+    edited.CacheTriangulation();
+    fresh.CacheTriangulation();
+
+    BOOST_CHECK( edited.IsTriangulationUpToDate() );
+    BOOST_CHECK_EQUAL( previous.use_count(), 1 );
+    BOOST_REQUIRE_EQUAL( edited.TriangulatedPolyCount(), fresh.TriangulatedPolyCount() );
+
+    for( unsigned ii = 0; ii < edited.TriangulatedPolyCount(); ii++ )
+    {
+        BOOST_CHECK_EQUAL( edited.TriangulatedPolygon( ii )->GetSourceOutlineIndex(),
+                           fresh.TriangulatedPolygon( ii )->GetSourceOutlineIndex() );
+        BOOST_CHECK_EQUAL( edited.TriangulatedPolygon( ii )->GetTriangleCount(),
+                           fresh.TriangulatedPolygon( ii )->GetTriangleCount() );
+    }
+
+    BOOST_CHECK_CLOSE( triangulatedArea( edited ), outline.Area() - hole.Area() + 1e12, 0.01 );
+
+    // The same geometry reuses all the inherited triangles
+    SHAPE_POLY_SET same = set.CloneDropTriangulation();
+
+    same.InheritTriangulation( previous );
+    BOOST_CHECK( !same.IsTriangulationUpToDate() );
+
+    same.CacheTriangulation();
+    BOOST_CHECK( same.IsTriangulationUpToDate() );
+    BOOST_CHECK_EQUAL( same.TriangulatedPolyCount(), set.TriangulatedPolyCount() );
+    BOOST_CHECK_CLOSE( triangulatedArea( same ), triangulatedArea( set ), 0.01 );
+}
+
+
+/**
+ * Check that a boolean session gives the same result as the individual operations.
+ */
+BOOST_AUTO_TEST_CASE( BooleanSession )
+{
+    auto square =
+            []( int aX, int aY, int aSize )
+            {
+                SHAPE_POLY_SET poly;
+
+                poly.NewOutline();
+                poly.Append( aX, aY );
+                poly.Append( aX + aSize, aY );
+                poly.Append( aX + aSize, aY + aSize );
+                poly.Append( aX, aY + aSize );
+                return poly;
+            };
+
+    SHAPE_POLY_SET base = square( 0, 0, 1000 );
+    SHAPE_POLY_SET expected = base;
+
+    SHAPE_POLY_SET::BOOLEAN_SESSION session( base, SHAPE_POLY_SET::PM_FAST );
+
+    std::vector<SHAPE_POLY_SET> added = { square( 900, 0, 200 ), square( -100, 500, 200 ) };
+    std::vector<SHAPE_POLY_SET> removed = { square( 100, 100, 100 ), square( 500, 500, 100 ),
+                                            square( 1000, 100, 50 ) };
+
+    for( const SHAPE_POLY_SET& poly : added )
+    {
+        expected.BooleanAdd( poly, SHAPE_POLY_SET::PM_FAST );
+        session.Add( poly );
+    }
+
+    for( const SHAPE_POLY_SET& poly : removed )
+    {
+        expected.BooleanSubtract( poly, SHAPE_POLY_SET::PM_FAST );
+        session.Subtract( poly );
+    }
+
+    expected.BooleanIntersection( square( 0, 0, 800 ), SHAPE_POLY_SET::PM_FAST );
+    session.Intersect( square( 0, 0, 800 ) );
+
+    session.Finish( base );
+
+    BOOST_CHECK_EQUAL( base.OutlineCount(), expected.OutlineCount() );
+    BOOST_CHECK_EQUAL( base.TotalVertices(), expected.TotalVertices() );
+    BOOST_CHECK_EQUAL( base.Area(), expected.Area() );
+}
+
+
+/**
+ * Check that a boolean session without operands gives back the subject unchanged.
+ */
+BOOST_AUTO_TEST_CASE( BooleanSessionWithoutOperands )
+{
+    // The collinear vertex would be dropped by a boolean operation
+    SHAPE_POLY_SET base;
+
+    base.NewOutline();
+    base.Append( 0, 0 );
+    base.Append( 500, 0 );
+    base.Append( 1000, 0 );
+    base.Append( 1000, 1000 );
+    base.Append( 0, 1000 );
+    base.CacheTriangulation();
+
+    SHAPE_POLY_SET::BOOLEAN_SESSION session( base, SHAPE_POLY_SET::PM_FAST );
+    SHAPE_POLY_SET                  result;
+
+    session.Finish( result );
+
+    BOOST_CHECK_EQUAL( result.TotalVertices(), 5 );
+    BOOST_CHECK( result.COutline( 0 ).CompareGeometry( base.COutline( 0 ) ) );
+
+    SHAPE_POLY_SET::BOOLEAN_SESSION inPlace( base, SHAPE_POLY_SET::PM_FAST );
+
+    inPlace.Finish( base );
+
+    BOOST_CHECK_EQUAL( base.TotalVertices(), 5 );
+    BOOST_CHECK( base.IsTriangulationUpToDate() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -257,4 +257,116 @@ BOOST_AUTO_TEST_CASE( CollideSegments )
     }
 }
 
+
+/**
+ * Check that the edge index gives the same answers as walking all the edges
+ */
+BOOST_AUTO_TEST_CASE( EdgeIndex )
+{
+    // Large enough contours to be indexed
+    auto polygon =
+            []( const VECTOR2I& aCenter, int aRadius, int aCount )
+            {
+                SHAPE_LINE_CHAIN chain;
+
+                for( int ii = 0; ii < aCount; ii++ )
+                {
+                    // A wobbly circle, so that the edges are not all alike
+                    EDA_ANGLE angle = FULL_CIRCLE * ii / aCount;
+                    int       radius = aRadius + ( ii % 3 ) * aRadius / 20;
+
+                    chain.Append( aCenter + VECTOR2I( KiROUND( radius * angle.Cos() ),
+                                                      KiROUND( radius * angle.Sin() ) ) );
+                }
+
+                chain.SetClosed( true );
+                return chain;
+            };
+
+    SHAPE_POLY_SET plain;
+
+    plain.AddOutline( polygon( { 0, 0 }, 100000, 500 ) );
+    plain.AddHole( polygon( { 30000, 0 }, 30000, 200 ) );
+    plain.AddOutline( polygon( { 300000, 0 }, 50000, 40 ) );
+
+    SHAPE_POLY_SET indexed = plain;
+
+    BOOST_CHECK( !indexed.HasEdgeIndex() );
+    indexed.BuildEdgeIndex();
+    BOOST_REQUIRE( indexed.HasEdgeIndex() );
+
+    auto checkPoint =
+            [&]( const VECTOR2I& aPt )
+            {
+                BOOST_TEST_CONTEXT( "Point " << aPt )
+                {
+                    BOOST_CHECK_EQUAL( indexed.Contains( aPt ), plain.Contains( aPt ) );
+                    BOOST_CHECK_EQUAL( indexed.Contains( aPt, -1, 500 ),
+                                       plain.Contains( aPt, -1, 500 ) );
+                    BOOST_CHECK_EQUAL( indexed.PointInside( aPt ), plain.PointInside( aPt ) );
+                    BOOST_CHECK_EQUAL( indexed.SquaredDistance( aPt ),
+                                       plain.SquaredDistance( aPt ) );
+                    BOOST_CHECK_EQUAL( indexed.Collide( aPt, 2000 ), plain.Collide( aPt, 2000 ) );
+
+                    SEG seg( aPt, aPt + VECTOR2I( 7000, -3000 ) );
+
+                    BOOST_CHECK_EQUAL( indexed.SquaredDistanceToSeg( seg ),
+                                       plain.SquaredDistanceToSeg( seg ) );
+                }
+            };
+
+    for( int x = -120000; x <= 370000; x += 9973 )
+    {
+        for( int y = -120000; y <= 120000; y += 7919 )
+            checkPoint( { x, y } );
+    }
+
+    for( auto it = plain.CIterateWithHoles(); it; it++ )
+        checkPoint( *it );
+
+    // Moving keeps the index up to date
+    plain.Move( { 1234, -5678 } );
+    indexed.Move( { 1234, -5678 } );
+    BOOST_CHECK( indexed.HasEdgeIndex() );
+
+    for( int x = -120000; x <= 370000; x += 19997 )
+    {
+        for( int y = -120000; y <= 120000; y += 15887 )
+            checkPoint( { x, y } );
+    }
+
+    // Other edits and copies drop it
+    SHAPE_POLY_SET copy = indexed;
+    BOOST_CHECK( !copy.HasEdgeIndex() );
+
+    indexed.Rotate( ANGLE_90 );
+    BOOST_CHECK( !indexed.HasEdgeIndex() );
+
+    // So does editing a contour in place, while reading or iterating over it doesn't
+    indexed.BuildEdgeIndex();
+    BOOST_CHECK_EQUAL( indexed.COutline( 0 ).PointCount(), 500 );
+    BOOST_CHECK( indexed.HasEdgeIndex() );
+
+    int vertices = 0;
+    int segments = 0;
+
+    for( auto it = indexed.CIterateWithHoles(); it; it++ )
+        vertices++;
+
+    for( auto it = indexed.CIterateSegmentsWithHoles(); it; it++ )
+        segments += ( *it ).Length() > 0;
+
+    BOOST_CHECK_EQUAL( vertices, indexed.TotalVertices() );
+    BOOST_CHECK( segments > 0 );
+    BOOST_CHECK( !indexed.IsPolygonSelfIntersecting( 0 ) );
+    BOOST_CHECK( indexed.HasEdgeIndex() );
+
+    indexed.Outline( 0 ).SetPoint( 0, { 0, 0 } );
+    BOOST_CHECK( !indexed.HasEdgeIndex() );
+
+    indexed.BuildEdgeIndex();
+    indexed.Hole( 0, 0 ).SetPoint( 0, { 30000, 0 } );
+    BOOST_CHECK( !indexed.HasEdgeIndex() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -321,4 +321,151 @@ BOOST_AUTO_TEST_CASE( FlipUpDown )
 }
 
 
+BOOST_AUTO_TEST_CASE( GetItemById )
+{
+    BOARD board;
+
+    PCB_TRACK* track = new PCB_TRACK( &board );
+    board.Add( track );
+
+    FOOTPRINT* footprint = new FOOTPRINT( &board );
+    PAD*       pad = new PAD( footprint );
+    footprint->Add( pad );
+    board.Add( footprint );
+
+    BOOST_CHECK_EQUAL( board.GetItem( track->m_Uuid ), track );
+    BOOST_CHECK_EQUAL( board.GetItem( footprint->m_Uuid ), footprint );
+    BOOST_CHECK_EQUAL( board.GetItem( pad->m_Uuid ), pad );
+    BOOST_CHECK_EQUAL( board.GetItem( footprint->Reference().m_Uuid ), &footprint->Reference() );
+
+    // Children added to a footprint already on the board are indexed too
+    PAD* secondPad = new PAD( footprint );
+    footprint->Add( secondPad );
+    BOOST_CHECK_EQUAL( board.GetItem( secondPad->m_Uuid ), secondPad );
+
+    // Removing a duplicate sharing the KIID leaves the original found by the fallback scan
+    PCB_TRACK* duplicate = new PCB_TRACK( *track );
+    board.Add( duplicate );
+    BOOST_CHECK_EQUAL( board.GetItem( track->m_Uuid ), duplicate );
+
+    board.Remove( duplicate );
+    delete duplicate;
+    BOOST_CHECK_EQUAL( board.GetItem( track->m_Uuid ), track );
+
+    KIID trackId = track->m_Uuid;
+    KIID padId = secondPad->m_Uuid;
+
+    board.Remove( track );
+    footprint->Remove( secondPad );
+
+    BOOST_CHECK_EQUAL( board.GetItem( trackId ), DELETED_BOARD_ITEM::GetInstance() );
+    BOOST_CHECK_EQUAL( board.GetItem( padId ), DELETED_BOARD_ITEM::GetInstance() );
+    BOOST_CHECK( board.CheckItemByIdCache() );
+
+    delete track;
+    delete secondPad;
+
+    // Replacing a footprint's contents drops its old children from the index
+    KIID      oldPadId = pad->m_Uuid;
+    FOOTPRINT replacement( &board );
+    replacement.Add( new PAD( &replacement ) );
+
+    *footprint = replacement;
+
+    BOOST_CHECK_EQUAL( board.GetItem( oldPadId ), DELETED_BOARD_ITEM::GetInstance() );
+    BOOST_CHECK_EQUAL( board.GetItem( footprint->Pads().front()->m_Uuid ),
+                       footprint->Pads().front() );
+    BOOST_CHECK( board.CheckItemByIdCache() );
+
+    delete pad;
+}
+
+
+BOOST_AUTO_TEST_CASE( RemoveItems )
+{
+    BOARD                    board;
+    std::vector<BOARD_ITEM*> removed;
+
+    for( int i = 0; i < 100; i++ )
+    {
+        PCB_TRACK* track = new PCB_TRACK( &board );
+        board.Add( track );
+
+        if( i % 3 == 0 )
+            removed.push_back( track );
+    }
+
+    PCB_SHAPE* shape = new PCB_SHAPE( &board );
+    board.Add( shape );
+    removed.push_back( shape );
+
+    ZONE* zone = new ZONE( &board );
+    board.Add( zone );
+
+    board.RemoveItems( removed );
+
+    BOOST_CHECK_EQUAL( board.Tracks().size(), 66 );
+    BOOST_CHECK_EQUAL( board.Drawings().size(), 0 );
+    BOOST_CHECK_EQUAL( board.Zones().size(), 1 );
+
+    for( BOARD_ITEM* item : removed )
+    {
+        BOOST_CHECK( item->GetFlags() & STRUCT_DELETED );
+        BOOST_CHECK_EQUAL( board.GetItem( item->m_Uuid ), DELETED_BOARD_ITEM::GetInstance() );
+        delete item;
+    }
+
+    BOOST_CHECK( board.CheckItemByIdCache() );
+}
+
+
+BOOST_AUTO_TEST_CASE( ZoneCopySharesFill )
+{
+    BOARD          board;
+    ZONE           zone( &board );
+    SHAPE_POLY_SET fill;
+
+    fill.NewOutline();
+    fill.Append( 0, 0 );
+    fill.Append( 1000, 0 );
+    fill.Append( 1000, 1000 );
+
+    zone.SetLayer( F_Cu );
+    zone.SetFilledPolysList( F_Cu, fill );
+
+    ZONE copy( zone );
+
+    BOOST_CHECK( copy.GetFilledPolysList( F_Cu ) == zone.GetFilledPolysList( F_Cu ) );
+
+    // Modifying one of them must not change the other
+    copy.Move( VECTOR2I( 500, 0 ) );
+
+    BOOST_CHECK( copy.GetFilledPolysList( F_Cu ) != zone.GetFilledPolysList( F_Cu ) );
+    BOOST_CHECK_EQUAL( zone.GetFilledPolysList( F_Cu )->CVertex( 0 ), VECTOR2I( 0, 0 ) );
+    BOOST_CHECK_EQUAL( copy.GetFilledPolysList( F_Cu )->CVertex( 0 ), VECTOR2I( 500, 0 ) );
+
+    copy.UnFill();
+
+    BOOST_CHECK( copy.GetFilledPolysList( F_Cu )->IsEmpty() );
+    BOOST_CHECK_EQUAL( zone.GetFilledPolysList( F_Cu )->OutlineCount(), 1 );
+
+    // Building the caches of a shared fill is a modification too
+    ZONE triangulated( zone );
+
+    BOOST_CHECK( !zone.GetFilledPolysList( F_Cu )->IsTriangulationUpToDate() );
+
+    triangulated.CacheTriangulation( F_Cu );
+
+    BOOST_CHECK( triangulated.GetFilledPolysList( F_Cu ) != zone.GetFilledPolysList( F_Cu ) );
+    BOOST_CHECK( triangulated.GetFilledPolysList( F_Cu )->IsTriangulationUpToDate() );
+    BOOST_CHECK( !zone.GetFilledPolysList( F_Cu )->IsTriangulationUpToDate() );
+    BOOST_CHECK( !zone.GetFilledPolysList( F_Cu )->HasEdgeIndex() );
+
+    // Once nothing else uses it, a fill is modified in place
+    SHAPE_POLY_SET* before = triangulated.GetFilledPolysList( F_Cu ).get();
+
+    BOOST_CHECK_EQUAL( triangulated.GetFill( F_Cu ), before );
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,198 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Test suite for the lazily parsed footprint cache of the s-expression library plugin.
+ */
+
+#include <qa_utils/wx_utils/temp_cache_home.h>
+#include <qa_utils/wx_utils/unit_test_utils.h>
+
+#include <wx/ffile.h>
+#include <wx/filename.h>
+
+#include <footprint.h>
+#include <ki_exception.h>
+
+// Code under test
+#include <pcb_io/kicad_sexpr/pcb_io_kicad_sexpr.h>
+
+
+namespace
+{
+
+std::string footprintFile( const std::string& aDescription )
+{
+    return "(footprint \"R\" (version 20240108) (generator \"pcbnew\") (layer \"F.Cu\")\n"
+           "  (descr \"" + aDescription + "\")\n"
+           "  (tags \"resistor\")\n"
+           "  (pad \"1\" smd rect (at -1 0) (size 1 1) (layers \"F.Cu\"))\n"
+           "  (pad \"2\" smd rect (at 1 0) (size 1 1) (layers \"F.Cu\"))\n"
+           ")\n";
+}
+
+
+struct FOOTPRINT_LIB_CACHE_FIXTURE
+{
+    FOOTPRINT_LIB_CACHE_FIXTURE() :
+            m_cacheHome( wxT( "kicad_fp_cache" ) )
+    {
+        wxFileName libFn;
+        libFn.AssignDir( m_cacheHome.GetPath() );
+        libFn.AppendDir( wxT( "test.pretty" ) );
+        libFn.Mkdir();
+        m_libPath = libFn.GetPath();
+
+        writeFile( wxT( "R" ), footprintFile( "Alpha" ) );
+        writeFile( wxT( "Broken" ), "(footprint \"Broken\" (layer \"F.Cu\")\n  (pad \"1\"" );
+    }
+
+    wxString footprintPath( const wxString& aName )
+    {
+        return wxFileName( m_libPath, aName, wxT( "kicad_mod" ) ).GetFullPath();
+    }
+
+    void writeFile( const wxString& aName, const std::string& aContent )
+    {
+        wxFFile file( footprintPath( aName ), wxT( "wb" ) );
+        file.Write( aContent.data(), aContent.size() );
+    }
+
+    ///< Keeps the indexes written by the tests out of the user cache
+    KI_TEST::TEMP_CACHE_HOME m_cacheHome;
+    wxString                 m_libPath;
+};
+
+} // namespace
+
+
+BOOST_FIXTURE_TEST_SUITE( FootprintLibCache, FOOTPRINT_LIB_CACHE_FIXTURE )
+
+
+/**
+ * Enumerating a library must not need its footprints to parse, and a footprint which doesn't
+ * parse must report its error when it is loaded.
+ */
+BOOST_AUTO_TEST_CASE( LazyLoad )
+{
+    PCB_IO_KICAD_SEXPR plugin;
+    wxArrayString      names;
+
+    plugin.FootprintEnumerate( names, m_libPath, false );
+
+    BOOST_CHECK_EQUAL( names.size(), 2 );
+    BOOST_CHECK( names.Index( wxT( "R" ) ) != wxNOT_FOUND );
+    BOOST_CHECK( names.Index( wxT( "Broken" ) ) != wxNOT_FOUND );
+
+    std::unique_ptr<FOOTPRINT> footprint( plugin.FootprintLoad( m_libPath, wxT( "R" ) ) );
+
+    BOOST_REQUIRE( footprint );
+    BOOST_CHECK_EQUAL( footprint->GetLibDescription(), wxT( "Alpha" ) );
+    BOOST_CHECK_EQUAL( footprint->Pads().size(), 2 );
+
+    BOOST_CHECK_THROW( plugin.FootprintLoad( m_libPath, wxT( "Broken" ) ), IO_ERROR );
+    BOOST_CHECK_THROW( plugin.GetEnumeratedFootprint( m_libPath, wxT( "Broken" ) ), IO_ERROR );
+
+    FOOTPRINT_METADATA metadata;
+
+    BOOST_CHECK_THROW( plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "Broken" ),
+                                                              metadata ),
+                       IO_ERROR );
+}
+
+
+/**
+ * Check that the library index is read back by a later session, and ignored once a footprint
+ * file changes.
+ */
+BOOST_AUTO_TEST_CASE( IndexRoundTrip )
+{
+    FOOTPRINT_METADATA metadata;
+
+    {
+        PCB_IO_KICAD_SEXPR plugin;
+
+        BOOST_REQUIRE( plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "R" ), metadata ) );
+        BOOST_CHECK_EQUAL( metadata.m_Description, wxT( "Alpha" ) );
+        BOOST_CHECK_EQUAL( metadata.m_Keywords, wxT( "resistor" ) );
+        BOOST_CHECK_EQUAL( metadata.m_PadCount, 2 );
+
+        // The index is written once every footprint was looked at, broken ones included
+        BOOST_CHECK_THROW( plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "Broken" ),
+                                                                  metadata ),
+                           IO_ERROR );
+    }
+
+    // Change the file behind the cache's back without changing its size or time stamp: the
+    // index must be used instead of the file.
+    wxFileName fn( footprintPath( wxT( "R" ) ) );
+    wxDateTime modTime = fn.GetModificationTime();
+
+    writeFile( wxT( "R" ), footprintFile( "Omega" ) );
+    fn.SetTimes( nullptr, &modTime, nullptr );
+
+    {
+        PCB_IO_KICAD_SEXPR plugin;
+
+        BOOST_REQUIRE( plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "R" ), metadata ) );
+        BOOST_CHECK_EQUAL( metadata.m_Description, wxT( "Alpha" ) );
+    }
+
+    // Once the file time stamp changes, the index is stale
+    modTime.Add( wxTimeSpan::Minutes( 1 ) );
+    fn.SetTimes( nullptr, &modTime, nullptr );
+
+    {
+        PCB_IO_KICAD_SEXPR plugin;
+
+        BOOST_REQUIRE( plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "R" ), metadata ) );
+        BOOST_CHECK_EQUAL( metadata.m_Description, wxT( "Omega" ) );
+    }
+}
+
+
+/**
+ * A saved footprint is already known, so it must not hold back the library index.
+ */
+BOOST_AUTO_TEST_CASE( SaveKeepsMetadata )
+{
+    PCB_IO_KICAD_SEXPR plugin;
+    FOOTPRINT_METADATA metadata;
+
+    std::unique_ptr<FOOTPRINT> footprint( plugin.FootprintLoad( m_libPath, wxT( "R" ) ) );
+
+    BOOST_REQUIRE( footprint );
+
+    footprint->SetFPID( LIB_ID( wxEmptyString, wxT( "R2" ) ) );
+    footprint->SetLibDescription( wxT( "Saved" ) );
+    plugin.FootprintSave( m_libPath, footprint.get() );
+
+    BOOST_REQUIRE( plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "R2" ), metadata ) );
+    BOOST_CHECK_EQUAL( metadata.m_Description, wxT( "Saved" ) );
+    BOOST_CHECK_EQUAL( metadata.m_PadCount, 2 );
+
+    plugin.FootprintDelete( m_libPath, wxT( "R2" ) );
+
+    BOOST_CHECK( !plugin.GetEnumeratedFootprintMetadata( m_libPath, wxT( "R2" ), metadata ) );
+    BOOST_CHECK( !wxFileName::FileExists( footprintPath( wxT( "R2" ) ) ) );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
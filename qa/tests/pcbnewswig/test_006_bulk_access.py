@@ -0,0 +1,55 @@
+import pytest
+import pcbnew
+
+class TestBulkAccess:
+    pcb : pcbnew.BOARD = None
+
+    def setup_method(self):
+        self.pcb = pcbnew.LoadBoard("../data/pcbnew/tracks_arcs_vias.kicad_pcb")
+
+    def test_tracks_data(self):
+        tracks = [t for t in self.pcb.Tracks() if t.GetClass() in ('PCB_TRACK', 'PCB_ARC')]
+        data = self.pcb.GetTracksData()
+        assert (len(tracks), pcbnew.BULK_TRACK_FIELD_COUNT) == data.shape
+
+        for row, track in enumerate(tracks):
+            assert [track.GetStart()[0], track.GetStart()[1]] == \
+                   [data[row, pcbnew.BULK_TRACK_START_X], data[row, pcbnew.BULK_TRACK_START_Y]]
+            assert [track.GetEnd()[0], track.GetEnd()[1]] == \
+                   [data[row, pcbnew.BULK_TRACK_END_X], data[row, pcbnew.BULK_TRACK_END_Y]]
+            assert track.GetWidth() == data[row, pcbnew.BULK_TRACK_WIDTH]
+            assert track.GetNetCode() == data[row, pcbnew.BULK_TRACK_NETCODE]
+
+    def test_vias_and_pads_data(self):
+        vias = [t.Cast() for t in self.pcb.Tracks() if t.GetClass() == 'PCB_VIA']
+        data = self.pcb.GetViasData()
+        assert (2, pcbnew.BULK_VIA_FIELD_COUNT) == data.shape
+        assert [v.GetDrillValue() for v in vias] == \
+               [data[row, pcbnew.BULK_VIA_DRILL] for row in range(len(vias))]
+
+        pads = [p for f in self.pcb.Footprints() for p in f.Pads()]
+        data = self.pcb.GetPadsData()
+        assert (len(pads), pcbnew.BULK_PAD_FIELD_COUNT) == data.shape
+        assert [p.GetPosition()[0] for p in pads] == \
+               [data[row, pcbnew.BULK_PAD_X] for row in range(len(pads))]
+
+    def test_set_tracks_data(self):
+        data = self.pcb.GetTracksData()
+        data[0, pcbnew.BULK_TRACK_WIDTH] = 123000
+        assert self.pcb.SetTracksData(data)
+
+        track = [t for t in self.pcb.Tracks() if t.GetClass() in ('PCB_TRACK', 'PCB_ARC')][0]
+        assert 123000 == track.GetWidth()
+
+        # one row per track is required
+        assert not self.pcb.SetTracksData(data[1:])
+
+    def test_set_footprints_data(self):
+        data = self.pcb.GetFootprintsData()
+        data[0, pcbnew.BULK_FOOTPRINT_X] += 1000000
+        data[0, pcbnew.BULK_FOOTPRINT_ORIENTATION] = 90
+        assert self.pcb.SetFootprintsData(data)
+
+        footprint = self.pcb.GetFootprints()[0]
+        assert data[0, pcbnew.BULK_FOOTPRINT_X] == footprint.GetPosition()[0]
+        assert 90 == footprint.GetOrientationDegrees()
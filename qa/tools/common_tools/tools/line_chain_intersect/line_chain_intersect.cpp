@@ -0,0 +1,124 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright (C) 2024 KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include <wx/string.h>
+
+#include <core/profile.h>
+#include <geometry/shape_line_chain.h>
+#include <math/util.h>
+
+#include <qa_utils/utility_registry.h>
+
+
+/**
+ * A closed, star shaped outline of \a aCount vertices, like an imported board outline.
+ *
+ * The radius of each vertex is jittered, but as the vertices are sorted by angle the outline
+ * never intersects itself.
+ */
+static SHAPE_LINE_CHAIN noisyOutline( int aCount, int aRadius, unsigned aSeed )
+{
+    std::mt19937                       rng( aSeed );
+    std::uniform_int_distribution<int> jitter( -aRadius / 10, aRadius / 10 );
+    SHAPE_LINE_CHAIN                   chain;
+
+    for( int i = 0; i < aCount; i++ )
+    {
+        double angle = 2.0 * M_PI * i / aCount;
+        int    radius = aRadius + jitter( rng );
+
+        chain.Append( VECTOR2I( KiROUND( radius * cos( angle ) ),
+                                KiROUND( radius * sin( angle ) ) ) );
+    }
+
+    chain.SetClosed( true );
+    return chain;
+}
+
+
+int line_chain_intersect_main( int argc, char* argv[] )
+{
+    auto& os = std::cout;
+
+    if( argc < 2 )
+    {
+        os << "Usage: " << argv[0] << " <VERTICES> [REPS]\n";
+        return KI_TEST::RET_CODES::BAD_CMDLINE;
+    }
+
+    long count = 0;
+    long reps = 1;
+
+    wxString( argv[1] ).ToLong( &count );
+
+    if( argc > 2 )
+        wxString( argv[2] ).ToLong( &reps );
+
+    if( count < 3 || reps < 1 )
+        return KI_TEST::RET_CODES::BAD_CMDLINE;
+
+    SHAPE_LINE_CHAIN outline = noisyOutline( count, 100000000, 1 );
+    SHAPE_LINE_CHAIN other = noisyOutline( count, 100000000, 2 );
+
+    other.Move( VECTOR2I( 50000000, 0 ) );
+
+    int found = 0;
+
+    PROF_TIMER selfTimer( "SelfIntersecting" );
+
+    for( long ii = 0; ii < reps; ii++ )
+        found += !!outline.SelfIntersecting();
+
+    selfTimer.Stop();
+
+    os << count << " vertices, " << found << " self-intersecting" << std::endl;
+    selfTimer.Show( os );
+
+    SHAPE_LINE_CHAIN::INTERSECTIONS ips;
+
+    PROF_TIMER isectTimer( "Intersect" );
+
+    for( long ii = 0; ii < reps; ii++ )
+    {
+        ips.clear();
+        outline.Intersect( other, ips );
+    }
+
+    isectTimer.Stop();
+
+    os << ips.size() << " intersections" << std::endl;
+    isectTimer.Show( os );
+
+    return KI_TEST::RET_CODES::OK;
+}
+
+
+static bool registered = UTILITY_REGISTRY::Register( {
+        "line_chain_intersect",
+        "Benchmark SHAPE_LINE_CHAIN self-intersection and chain intersection searches",
+        line_chain_intersect_main,
+} );